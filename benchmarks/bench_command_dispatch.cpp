@@ -0,0 +1,164 @@
+/**
+ * @file bench_command_dispatch.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief デバイス内のコマンド振り分け（if/else チェーン vs コマンドテーブル）のベンチマーク
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_can/drivers/can_driver_interface.hpp"
+#include "gn10_can/utils/can_converter.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t FRAMES_PER_UPDATE = 64;
+constexpr std::size_t ITERATIONS        = 50000;
+
+/**
+ * @brief 用意したフレームを順に受信させるドライバー
+ *
+ */
+class ReplayDriver final : public drivers::ICANDriver
+{
+public:
+    bool send(const CANFrame&) override
+    {
+        return true;
+    }
+
+    bool receive(CANFrame& out_frame) override
+    {
+        if (remaining_ == 0) {
+            return false;
+        }
+        remaining_--;
+        out_frame = frames_[index_++ % frames_.size()];
+        return true;
+    }
+
+    void rearm(std::size_t count)
+    {
+        remaining_ = count;
+    }
+
+    std::array<CANFrame, 4> frames_{};
+
+private:
+    std::size_t remaining_ = 0;
+    std::size_t index_     = 0;
+};
+
+using ReplayBus = BasicBus<CANFrame, ReplayDriver, 16, 0>;
+
+/**
+ * @brief 従来の MotorDriverServer::on_receive() と同じ if/else チェーンで受信するデバイス
+ *
+ */
+class LegacyMotorDriverServer : public CANDevice
+{
+public:
+    LegacyMotorDriverServer(ICANBus& bus, uint8_t dev_id)
+        : CANDevice(bus, id::DeviceType::MotorDriver, dev_id)
+    {
+    }
+
+    void on_receive(const CANFrame& frame) override
+    {
+        auto id_fields = id::unpack(frame.id);
+
+        if (id_fields.is_command(id::MsgTypeMotorDriver::Init)) {
+            config_ = devices::MotorConfig::from_bytes(frame.data);
+        } else if (id_fields.is_command(id::MsgTypeMotorDriver::Target)) {
+            float val;
+            if (converter::unpack(frame.data.data(), frame.dlc, 0, val)) {
+                target_ = val;
+            }
+        } else if (id_fields.is_command(id::MsgTypeMotorDriver::Gain)) {
+            if (frame.dlc >= 5) {
+                uint8_t type_val = frame.data[0];
+                float gain_val;
+                if (type_val < static_cast<uint8_t>(devices::GainType::Count) &&
+                    converter::unpack(frame.data.data(), frame.dlc, 1, gain_val)) {
+                    gains_[type_val] = gain_val;
+                }
+            }
+        }
+    }
+
+    std::optional<devices::MotorConfig> config_;
+    std::optional<float> target_;
+    std::optional<float> gains_[static_cast<std::size_t>(devices::GainType::Count)];
+};
+
+/**
+ * @brief Init / Target / Gain / 未使用コマンドのフレームを順に受信させる
+ *
+ */
+void prepare_frames(ReplayDriver& driver)
+{
+    driver.frames_[0] =
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Init);
+    driver.frames_[1] = CANFrame::make(
+        id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Target, {0, 0, 128, 63}
+    );
+    driver.frames_[2] = CANFrame::make(
+        id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Gain, {0, 0, 0, 128, 63}
+    );
+    driver.frames_[3] =
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback);
+}
+
+/**
+ * @brief バスの update() で FRAMES_PER_UPDATE 個の受信を配送する時間を計測する
+ *
+ * 実際の受信と同じく、ルーティングテーブルから引いたデバイスへ BasicDevice::deliver() で配送します。
+ * if/else のデバイスは仮想関数 on_receive()、テーブルのデバイスは関数ポインタで呼ばれます。
+ *
+ * @return double 1フレームあたりの処理時間[ns]
+ */
+double measure_ns_per_frame(ReplayDriver& driver, ReplayBus& bus)
+{
+    double ns_per_update = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t) {
+        driver.rearm(FRAMES_PER_UPDATE);
+        bus.update();
+    });
+    return ns_per_update / static_cast<double>(FRAMES_PER_UPDATE);
+}
+
+}  // namespace
+
+int main()
+{
+    ReplayDriver legacy_driver;
+    prepare_frames(legacy_driver);
+    ReplayBus legacy_bus(legacy_driver);
+    LegacyMotorDriverServer legacy(legacy_bus, 1);
+
+    ReplayDriver table_driver;
+    prepare_frames(table_driver);
+    ReplayBus table_bus(table_driver);
+    devices::MotorDriverServer table(table_bus, 1);
+
+    double legacy_ns = measure_ns_per_frame(legacy_driver, legacy_bus);
+    double table_ns  = measure_ns_per_frame(table_driver, table_bus);
+
+    bench::do_not_optimize(legacy);
+    bench::do_not_optimize(table);
+    std::printf("%20s %20s %10s\n", "if/else[ns/frame]", "table[ns/frame]", "speedup");
+    std::printf("%20.2f %20.2f %9.2fx\n", legacy_ns, table_ns, legacy_ns / table_ns);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file bench_dispatch.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信フレームの配送先探索（線形探索 vs ルーティングテーブル）のベンチマーク
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/routing_table.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t MAX_BENCH_DEVICES = 64;
+constexpr std::size_t ITERATIONS        = 2000000;
+constexpr std::size_t SMALL_CAPACITY    = 16;  // 索引を使う表になる容量 (CANBus の既定)
+
+/**
+ * @brief ベンチマーク用デバイス（CANDevice と同じく仮想関数で受信する）
+ *
+ */
+class BenchDevice
+{
+public:
+    virtual ~BenchDevice() = default;
+
+    virtual void on_receive(const CANFrame& frame)
+    {
+        received_bytes_ += frame.dlc;
+    }
+
+    uint32_t get_routing_id() const
+    {
+        return routing_id_;
+    }
+
+    uint32_t routing_id_     = 0;
+    uint32_t received_bytes_ = 0;
+    BenchDevice* route_next_ = nullptr;
+    BenchDevice* route_prev_ = nullptr;
+};
+
+/**
+ * @brief 従来の CANBus::dispatch() と同じ線形探索
+ *
+ */
+void dispatch_linear(
+    const std::array<BenchDevice*, MAX_BENCH_DEVICES>& devices,
+    std::size_t device_count,
+    const CANFrame& frame
+)
+{
+    uint32_t routing_id = frame.get_routing_id();
+    for (std::size_t i = 0; i < device_count; i++) {
+        BenchDevice* device = devices[i];
+        if (routing_id == device->get_routing_id()) {
+            device->on_receive(frame);
+        }
+    }
+}
+
+/**
+ * @brief ルーティングテーブルによる配送
+ *
+ * @tparam Table 先頭の配列の表 (容量256) または索引を使う表 (容量 SMALL_CAPACITY)
+ */
+template <typename Table>
+void dispatch_table(const Table& table, const CANFrame& frame)
+{
+    BenchDevice* device = table.find(frame.get_routing_id());
+    while (device != nullptr) {
+        BenchDevice* next = Table::next(device);
+        device->on_receive(frame);
+        device = next;
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf(
+        "%8s %16s %16s %16s %10s\n",
+        "devices",
+        "linear[ns/frame]",
+        "table[ns/frame]",
+        "small[ns/frame]",
+        "speedup"
+    );
+
+    for (std::size_t device_count : {std::size_t{1}, std::size_t{16}, std::size_t{64}}) {
+        std::array<BenchDevice, MAX_BENCH_DEVICES> storage{};
+        std::array<BenchDevice*, MAX_BENCH_DEVICES> devices{};
+        detail::RoutingTable<BenchDevice> table;
+        detail::RoutingTable<BenchDevice, SMALL_CAPACITY> small_table;
+
+        // デバイスを登録し、各デバイス宛てのフレームを1つずつ用意する
+        std::array<CANFrame, MAX_BENCH_DEVICES> frames{};
+        for (std::size_t idx = 0; idx < device_count; ++idx) {
+            storage[idx].routing_id_ = static_cast<uint32_t>(idx * 3 + 16);
+            devices[idx]             = &storage[idx];
+            table.insert(&storage[idx]);
+            small_table.insert(&storage[idx]);
+            frames[idx].id  = storage[idx].routing_id_ << id::BIT_WIDTH_COMMAND;
+            frames[idx].dlc = 8;
+        }
+
+        double linear_ns = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t idx) {
+            dispatch_linear(devices, device_count, frames[idx % device_count]);
+        });
+        double table_ns  = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t idx) {
+            dispatch_table(table, frames[idx % device_count]);
+        });
+
+        // ルーティングIDが全て異なるため、2つの表に登録してもデバイスのリンクは同じ値になる
+        char small_column[32] = "-";
+        if (device_count <= SMALL_CAPACITY) {
+            double small_ns = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t idx) {
+                dispatch_table(small_table, frames[idx % device_count]);
+            });
+            std::snprintf(small_column, sizeof(small_column), "%.2f", small_ns);
+        }
+
+        bench::do_not_optimize(storage);
+        std::printf(
+            "%8zu %16.2f %16.2f %16s %9.2fx\n",
+            device_count,
+            linear_ns,
+            table_ns,
+            small_column,
+            linear_ns / table_ns
+        );
+    }
+    return 0;
+}
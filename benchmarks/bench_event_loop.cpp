@@ -0,0 +1,223 @@
+/**
+ * @file bench_event_loop.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief EventLoop と 1kHz ポーリング・スピンループの、起床から配送までの遅延と CPU 使用率の比較
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/core/event_loop.hpp"
+#include "gn10_can/drivers/can_driver_interface.hpp"
+#include "gn10_can/utils/spsc_ring_buffer.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t FRAME_COUNT = 2000;
+constexpr auto FRAME_INTERVAL     = std::chrono::microseconds(997);  // ポーリング周期と位相をずらす
+
+uint64_t now_ns()
+{
+    auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count()
+    );
+}
+
+uint64_t thread_cpu_ns()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/**
+ * @brief 別スレッドから受信フレームを積み、eventfd で受信を知らせるドライバー (SocketCAN の代わり)
+ *
+ */
+class EventFdDriver : public drivers::ICANDriver
+{
+public:
+    EventFdDriver() : fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+
+    ~EventFdDriver() override
+    {
+        close(fd_);
+    }
+
+    void push_from_thread(const CANFrame& frame)
+    {
+        while (!ring_.try_push(frame)) {
+        }
+        uint64_t one  = 1;
+        ssize_t bytes = write(fd_, &one, sizeof(one));
+        (void)bytes;
+    }
+
+    bool send(const CANFrame&) override
+    {
+        return true;
+    }
+
+    bool receive(CANFrame& out_frame) override
+    {
+        return receive_batch(&out_frame, 1) == 1;
+    }
+
+    std::size_t receive_batch(CANFrame* out_frames, std::size_t max_frames) override
+    {
+        // 先に通知を消してから読み出す（読み出し後に積まれたフレームの通知を消さないため）
+        uint64_t count = 0;
+        ssize_t bytes  = read(fd_, &count, sizeof(count));
+        (void)bytes;
+        std::size_t received = 0;
+        while (received < max_frames && ring_.try_pop(out_frames[received])) {
+            received++;
+        }
+        return received;
+    }
+
+    int event_fd() const override
+    {
+        return fd_;
+    }
+
+private:
+    int fd_;
+    utils::SPSCRingBuffer<CANFrame, 256> ring_;
+};
+
+/**
+ * @brief フレームに埋め込まれた送信時刻から配送までの遅延を記録するデバイス
+ *
+ */
+class LatencyDevice : public CANDevice
+{
+public:
+    explicit LatencyDevice(ICANBus& bus) : CANDevice(bus, id::DeviceType::MotorDriver, 1)
+    {
+        latencies_ns.reserve(FRAME_COUNT);
+    }
+
+    void on_receive(const CANFrame& frame) override
+    {
+        uint64_t sent_ns = 0;
+        std::memcpy(&sent_ns, frame.data.data(), sizeof(sent_ns));
+        latencies_ns.push_back(now_ns() - sent_ns);
+        received.fetch_add(1, std::memory_order_release);
+    }
+
+    std::vector<uint64_t> latencies_ns;
+    std::atomic<std::size_t> received{0};
+};
+
+struct Result {
+    double mean_us;
+    double p99_us;
+    double max_us;
+    double cpu_percent;
+};
+
+/**
+ * @brief 受信スレッドを wait_and_update で回し、FRAME_COUNT 個のフレームの遅延と CPU 使用率を計測する
+ *
+ * @tparam WaitAndUpdate 受信スレッドの1周分の処理 (bus, loop を引数に取る)
+ */
+template <typename WaitAndUpdate>
+Result measure(WaitAndUpdate&& wait_and_update)
+{
+    EventFdDriver driver;
+    CANBus bus(driver);
+    LatencyDevice device(bus);
+    EventLoop<CANBus> loop(bus, driver.event_fd());
+    std::atomic<bool> running{true};
+
+    uint64_t cpu_ns  = 0;
+    uint64_t wall_ns = 0;
+    std::thread rx_thread([&] {
+        uint64_t cpu_start  = thread_cpu_ns();
+        uint64_t wall_start = now_ns();
+        while (running.load(std::memory_order_acquire)) {
+            wait_and_update(bus, loop);
+        }
+        cpu_ns  = thread_cpu_ns() - cpu_start;
+        wall_ns = now_ns() - wall_start;
+    });
+
+    CANFrame frame =
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback);
+    frame.dlc = 8;
+    auto next = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < FRAME_COUNT; ++i) {
+        next += FRAME_INTERVAL;
+        std::this_thread::sleep_until(next);
+        uint64_t sent_ns = now_ns();
+        std::memcpy(frame.data.data(), &sent_ns, sizeof(sent_ns));
+        driver.push_from_thread(frame);
+    }
+    while (device.received.load(std::memory_order_acquire) < FRAME_COUNT) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    running.store(false, std::memory_order_release);
+    loop.notify();
+    rx_thread.join();
+
+    std::vector<uint64_t>& samples = device.latencies_ns;
+    std::sort(samples.begin(), samples.end());
+    uint64_t total = 0;
+    for (uint64_t sample : samples) {
+        total += sample;
+    }
+    Result result;
+    result.mean_us     = static_cast<double>(total) / static_cast<double>(samples.size()) / 1000.0;
+    result.p99_us      = static_cast<double>(samples[samples.size() * 99 / 100]) / 1000.0;
+    result.max_us      = static_cast<double>(samples.back()) / 1000.0;
+    result.cpu_percent = 100.0 * static_cast<double>(cpu_ns) / static_cast<double>(wall_ns);
+    return result;
+}
+
+void print_row(const char* name, const Result& result)
+{
+    std::printf(
+        "%-14s %10.1f %10.1f %10.1f %10.1f\n",
+        name,
+        result.mean_us,
+        result.p99_us,
+        result.max_us,
+        result.cpu_percent
+    );
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf("%-14s %10s %10s %10s %10s\n", "mode", "mean[us]", "p99[us]", "max[us]", "cpu[%]");
+
+    print_row("event_loop", measure([](CANBus&, EventLoop<CANBus>& loop) { loop.run_once(-1); }));
+    print_row("poll_1khz", measure([](CANBus& bus, EventLoop<CANBus>&) {
+                  bus.update();
+                  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              }));
+    print_row("spin", measure([](CANBus& bus, EventLoop<CANBus>&) { bus.update(); }));
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file bench_frame_builder.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief Frame::make() で作成したフレームを送信する場合と、ビルダーで送信領域に直接書き込む場合の比較
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/basic_device.hpp"
+#include "gn10_can/core/concurrent_bus.hpp"
+#include "gn10_can/drivers/can_driver_interface.hpp"
+#include "gn10_can/drivers/fdcan_driver_interface.hpp"
+#include "gn10_can/utils/can_converter.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t ITERATIONS     = 2000000;
+constexpr std::size_t FLUSH_INTERVAL = 32;  // 受信スレッドが flush() を呼ぶ間隔[フレーム]
+
+/**
+ * @brief 送信されたフレームのデータ部を、HAL が送信バッファへ書き込むのと同じようにコピーするドライバー
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Interface 実装するドライバーインターフェース
+ */
+template <typename Frame, typename Interface>
+class MessageRamDriver final : public Interface
+{
+public:
+    bool send(const Frame& frame) override
+    {
+        std::memcpy(message_ram_.data(), frame.data.data(), Frame::padded_length(frame.dlc));
+        sent_bytes_ += frame.dlc;
+        return true;
+    }
+
+    bool receive(Frame&) override
+    {
+        return false;
+    }
+
+    std::array<uint8_t, Frame::MAX_DLC> message_ram_{};  // 送信バッファの代わり
+    uint64_t sent_bytes_ = 0;                            // 送信したデータ長の合計
+};
+
+/**
+ * @brief 角速度指令 (float を Count 個) を2通りの方法で送信するデバイス
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Count 送信する float の個数
+ */
+template <typename Frame, std::size_t Count>
+class BenchDevice : public BasicDevice<Frame>
+{
+public:
+    explicit BenchDevice(IBus<Frame>& bus) : BasicDevice<Frame>(bus, id::DeviceType::ESCHub, 1) {}
+
+    bool send_with_make(const float* values)
+    {
+        Frame frame =
+            Frame::make(this->device_type_, this->device_id_, id::MsgTypeESCHub::AngularVelocities);
+        for (std::size_t i = 0; i < Count; i++) {
+            converter::pack(frame.data, static_cast<uint8_t>(i * sizeof(float)), values[i]);
+        }
+        frame.dlc = sizeof(float) * Count;
+        return this->send_frame(frame, TxMode::Coalesce);
+    }
+
+    bool send_with_builder(const float* values)
+    {
+        auto tx = this->begin_frame(id::MsgTypeESCHub::AngularVelocities);
+        tx.write(values, Count);
+        return this->send_frame(tx, TxMode::Coalesce);
+    }
+
+    void on_receive(const Frame&) override {}
+};
+
+/**
+ * @brief 1フレームの作成・送信にかかる時間を計測する
+ *
+ * @tparam Bus 計測するバスの型 (BasicBus / BasicConcurrentBus)
+ * @tparam Count 送信する float の個数
+ * @param use_builder ビルダーで送信するか
+ * @return double 1フレームあたりの処理時間[ns]
+ */
+template <typename Bus, std::size_t Count>
+double measure(bool use_builder)
+{
+    using Frame     = typename Bus::FrameType;
+    using Interface = typename Bus::DriverType;
+
+    MessageRamDriver<Frame, Interface> driver;
+    Bus bus(driver);
+    BenchDevice<Frame, Count> device(bus);
+
+    std::array<float, Count> values{};
+    double ns_per_frame = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t i) {
+        values[0] = static_cast<float>(i);
+        if (use_builder) {
+            device.send_with_builder(values.data());
+        } else {
+            device.send_with_make(values.data());
+        }
+        if (i % FLUSH_INTERVAL == FLUSH_INTERVAL - 1) {
+            bus.flush();
+        }
+    });
+    bench::do_not_optimize(driver.sent_bytes_);
+    return ns_per_frame;
+}
+
+/**
+ * @brief BasicBus と BasicConcurrentBus で make() とビルダーを比較し、1行表示する
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Interface ドライバーインターフェース
+ * @tparam Count 送信する float の個数
+ */
+template <typename Frame, typename Interface, std::size_t Count>
+void print_row(const char* frame)
+{
+    using Bus           = BasicBus<Frame, Interface>;
+    using ConcurrentBus = BasicConcurrentBus<Frame, Interface>;
+
+    std::printf(
+        "%-8s %5zuxf32 %10.2f %10.2f %12.2f %12.2f\n",
+        frame,
+        Count,
+        measure<Bus, Count>(false),
+        measure<Bus, Count>(true),
+        measure<ConcurrentBus, Count>(false),
+        measure<ConcurrentBus, Count>(true)
+    );
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf(
+        "%-8s %9s %10s %10s %12s %12s\n",
+        "frame",
+        "payload",
+        "make",
+        "builder",
+        "mpsc make",
+        "mpsc builder"
+    );
+    print_row<CANFrame, drivers::ICANDriver, 2>("CAN");
+    print_row<FDCANFrame, drivers::IFDCANDriver, 4>("CAN FD");
+    print_row<FDCANFrame, drivers::IFDCANDriver, 16>("CAN FD");
+    std::printf("(ns/frame)\n");
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bench_gateway.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN ↔ CAN FD ゲートウェイの中継1フレームあたりの処理時間のベンチマーク
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_fd_gateway.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t ITERATIONS      = 200000;
+constexpr std::size_t FRAMES_PER_LOOP = 4;  // 1周期に中継するフレーム数
+
+/**
+ * @brief CAN → FD の中継1フレームあたりの処理時間を計測する
+ *
+ * 受信キューへの投入から、FD側ドライバーの send() までを1周期として計測します。
+ *
+ * @param packing パック送信を有効にするか
+ * @return double 1フレームあたりの処理時間[ns]
+ */
+double measure_ns_per_frame(bool packing)
+{
+    MockDriver can_driver;
+    MockFDDriver fd_driver;
+    CANBus can_bus(can_driver);
+    FDCANBus fd_bus(fd_driver);
+    CANFDGateway<> gateway(can_bus, fd_bus);
+
+    for (uint8_t dev_id = 0; dev_id < FRAMES_PER_LOOP; ++dev_id) {
+        gateway.add_route(id::DeviceType::MotorDriver, dev_id, GatewayDirection::CANToFD);
+    }
+    if (packing) {
+        gateway.enable_packing(
+            id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init
+        );
+    }
+
+    std::array<CANFrame, FRAMES_PER_LOOP> frames{};
+    for (uint8_t dev_id = 0; dev_id < FRAMES_PER_LOOP; ++dev_id) {
+        frames[dev_id] = CANFrame::make(
+            id::DeviceType::MotorDriver, dev_id, id::MsgTypeMotorDriver::Target, {1, 2, 3, 4}
+        );
+    }
+
+    double ns_per_loop = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t) {
+        for (const CANFrame& frame : frames) {
+            can_driver.push_receive_frame(frame);
+        }
+        can_bus.update();
+        gateway.update();
+        fd_driver.sent_frames.clear();
+    });
+
+    bench::do_not_optimize(gateway.stats());
+    return ns_per_loop / static_cast<double>(FRAMES_PER_LOOP);
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf("%10s %14s\n", "mode", "ns/frame");
+    std::printf("%10s %14.2f\n", "direct", measure_ns_per_frame(false));
+    std::printf("%10s %14.2f\n", "packed", measure_ns_per_frame(true));
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file bench_latency_profile.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 処理時間のヒストグラム (LatencyProfile) を Linux で記録し、デバイスの種類ごとに表示する
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+// GN10_CAN_ENABLE_LATENCY_PROFILE を定義してビルドする (benchmarks/CMakeLists.txt 参照)
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_can/devices/servo_motor_client.hpp"
+#include "gn10_can/devices/servo_motor_server.hpp"
+#include "gn10_can/devices/solenoid_driver_client.hpp"
+#include "gn10_can/devices/solenoid_driver_server.hpp"
+#include "gn10_can/utils/cycle_counter.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t ITERATIONS = 100000;
+
+void print_row(const char* name, const utils::LatencyHistogram& histogram)
+{
+    if (histogram.count() == 0) {
+        return;
+    }
+    std::printf(
+        "%-16s %10u %10u %10u %10u\n",
+        name,
+        static_cast<unsigned>(histogram.count()),
+        static_cast<unsigned>(histogram.percentile(50)),
+        static_cast<unsigned>(histogram.percentile(99)),
+        static_cast<unsigned>(histogram.max())
+    );
+}
+
+}  // namespace
+
+int main()
+{
+    // 上位側 (Client) の送信フレームを、下位側 (Server) のバスで受信して計測する
+    MockDriver client_driver;
+    CANBus client_bus(client_driver);
+    devices::MotorDriverClient motor(client_bus, 0);
+    devices::ServoMotorClient servo(client_bus, 0);
+    devices::SolenoidDriverClient solenoid(client_bus, 0);
+
+    MockDriver server_driver;
+    CANBus server_bus(server_driver);
+    devices::MotorDriverServer motor_server(server_bus, 0);
+    devices::ServoMotorServer servo_server(server_bus, 0);
+    devices::SolenoidDriverServer solenoid_server(server_bus, 0);
+
+    client_bus.set_cycle_counter(utils::monotonic_ns);
+    server_bus.set_cycle_counter(utils::monotonic_ns);
+
+    float target  = 0.0f;
+    uint8_t state = 0;
+    for (std::size_t i = 0; i < ITERATIONS; ++i) {
+        motor.set_target(static_cast<float>(i));
+        servo.set_angle_rad(static_cast<float>(i) * 0.001f);
+        solenoid.set_target(static_cast<uint8_t>(i));
+        for (const CANFrame& frame : client_driver.sent_frames) {
+            server_driver.push_receive_frame(frame);
+        }
+        client_driver.sent_frames.clear();
+
+        server_bus.update();
+        motor_server.get_new_target(target);
+        solenoid_server.get_new_target(state);
+    }
+
+    const LatencyProfile& server = server_bus.latency_profile();
+    std::printf("%-16s %10s %10s %10s %10s\n", "site", "count", "p50[ns]", "p99[ns]", "max[ns]");
+    print_row("MotorDriver", server.handler(id::DeviceType::MotorDriver));
+    print_row("ServoMotor", server.handler(id::DeviceType::ServoMotor));
+    print_row("SolenoidDriver", server.handler(id::DeviceType::SolenoidDriver));
+    print_row("update", server.update());
+    print_row("send", client_bus.latency_profile().send());
+    std::printf("(p50/p99 are log2 bucket upper bounds)\n");
+    return 0;
+}
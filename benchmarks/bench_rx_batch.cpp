@@ -0,0 +1,90 @@
+/**
+ * @file bench_rx_batch.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief receive_batch() の読み出し数ごとの受信スループットのベンチマーク
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t FRAMES_PER_UPDATE = 64;
+constexpr std::size_t ITERATIONS        = 50000;
+
+/**
+ * @brief 受信バイト数を数えるだけのデバイス
+ *
+ */
+class BenchDevice : public CANDevice
+{
+public:
+    explicit BenchDevice(ICANBus& bus) : CANDevice(bus, id::DeviceType::MotorDriver, 1) {}
+
+    void on_receive(const CANFrame& frame) override
+    {
+        received_bytes_ += frame.dlc;
+    }
+
+    uint32_t received_bytes_ = 0;
+};
+
+/**
+ * @brief 読み出し数 RxBatchSize のバスで FRAMES_PER_UPDATE 個の受信を処理する時間を計測する
+ *
+ * @tparam RxBatchSize receive_batch() で1度に読み出す最大フレーム数
+ * @return double 1フレームあたりの処理時間[ns]
+ */
+template <std::size_t RxBatchSize>
+double measure_ns_per_frame()
+{
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 16, 8, RxBatchSize> bus(driver);
+    BenchDevice device(bus);
+
+    CANFrame frame;
+    frame.id  = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    frame.dlc = 8;
+
+    double ns_per_update = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t) {
+        for (std::size_t i = 0; i < FRAMES_PER_UPDATE; ++i) {
+            driver.push_receive_frame(frame);
+        }
+        bus.update();
+    });
+
+    bench::do_not_optimize(device.received_bytes_);
+    return ns_per_update / static_cast<double>(FRAMES_PER_UPDATE);
+}
+
+/**
+ * @brief 計測結果を1行表示する
+ *
+ */
+void print_row(std::size_t batch_size, double ns_per_frame)
+{
+    std::printf("%8zu %14.2f %16.0f\n", batch_size, ns_per_frame, 1e9 / ns_per_frame);
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf("%8s %14s %16s\n", "batch", "ns/frame", "frames/s");
+    print_row(1, measure_ns_per_frame<1>());
+    print_row(8, measure_ns_per_frame<8>());
+    print_row(32, measure_ns_per_frame<32>());
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file bench_static_bus.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信処理（動的な BasicBus vs コンパイル時に構成を固定した BasicStaticBus）のベンチマーク
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/static_bus.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_can/devices/servo_motor_server.hpp"
+#include "gn10_can/devices/solenoid_driver_server.hpp"
+#include "gn10_can/drivers/can_driver_interface.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t FRAMES_PER_UPDATE = 64;
+constexpr std::size_t ITERATIONS        = 50000;
+
+/**
+ * @brief 用意したフレームを順に受信させるドライバー（両方のバスで具体型として静的に解決される）
+ *
+ */
+class ReplayDriver final : public drivers::ICANDriver
+{
+public:
+    bool send(const CANFrame&) override
+    {
+        return true;
+    }
+
+    bool receive(CANFrame& out_frame) override
+    {
+        if (remaining_ == 0) {
+            return false;
+        }
+        remaining_--;
+        out_frame = frames_[index_++ % frames_.size()];
+        return true;
+    }
+
+    std::size_t receive_batch(CANFrame* out_frames, std::size_t max_frames) override
+    {
+        std::size_t received = 0;
+        while (received < max_frames && receive(out_frames[received])) {
+            received++;
+        }
+        return received;
+    }
+
+    void rearm(std::size_t count)
+    {
+        remaining_ = count;
+    }
+
+    std::array<CANFrame, 4> frames_{};
+
+private:
+    std::size_t remaining_ = 0;
+    std::size_t index_     = 0;
+};
+
+/**
+ * @brief 3種類のデバイス宛てのフレームを用意する
+ *
+ */
+void prepare_frames(ReplayDriver& driver)
+{
+    driver.frames_[0] = CANFrame::make(
+        id::DeviceType::MotorDriver, 0, id::MsgTypeMotorDriver::Target, {0, 0, 128, 63}
+    );
+    driver.frames_[1] = CANFrame::make(
+        id::DeviceType::ServoMotor, 1, id::MsgTypeServoMotor::AngleRad, {0, 0, 128, 63}
+    );
+    driver.frames_[2] =
+        CANFrame::make(id::DeviceType::SolenoidDriver, 2, id::MsgTypeSolenoidDriver::Target, {5});
+    driver.frames_[3] =
+        CANFrame::make(id::DeviceType::MotorDriver, 7, id::MsgTypeMotorDriver::Target);  // 宛先なし
+}
+
+/**
+ * @brief バスの update() で FRAMES_PER_UPDATE 個の受信を処理する時間を計測する
+ *
+ * @return double 1フレームあたりの処理時間[ns]
+ */
+template <typename Bus>
+double measure_ns_per_frame(ReplayDriver& driver, Bus& bus)
+{
+    double ns_per_update = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t) {
+        driver.rearm(FRAMES_PER_UPDATE);
+        bus.update();
+    });
+    return ns_per_update / static_cast<double>(FRAMES_PER_UPDATE);
+}
+
+}  // namespace
+
+int main()
+{
+    ReplayDriver dynamic_driver;
+    prepare_frames(dynamic_driver);
+    BasicBus<CANFrame, ReplayDriver, 16, 0> dynamic_bus(dynamic_driver);
+    devices::MotorDriverServer dynamic_motor(dynamic_bus, 0);
+    devices::ServoMotorServer dynamic_servo(dynamic_bus, 1);
+    devices::SolenoidDriverServer dynamic_solenoid(dynamic_bus, 2);
+
+    ReplayDriver static_driver;
+    prepare_frames(static_driver);
+    BasicStaticBus<
+        CANFrame,
+        ReplayDriver,
+        devices::MotorDriverServer,
+        devices::ServoMotorServer,
+        devices::SolenoidDriverServer>
+        static_bus(static_driver);
+    devices::MotorDriverServer static_motor(static_bus, 0);
+    devices::ServoMotorServer static_servo(static_bus, 1);
+    devices::SolenoidDriverServer static_solenoid(static_bus, 2);
+    static_bus.bind(static_motor, static_servo, static_solenoid);
+
+    double dynamic_ns = measure_ns_per_frame(dynamic_driver, dynamic_bus);
+    double static_ns  = measure_ns_per_frame(static_driver, static_bus);
+
+    bench::do_not_optimize(dynamic_motor);
+    bench::do_not_optimize(static_motor);
+    std::printf("%18s %18s %10s\n", "dynamic[ns/frame]", "static[ns/frame]", "speedup");
+    std::printf("%18.2f %18.2f %9.2fx\n", dynamic_ns, static_ns, dynamic_ns / static_ns);
+    std::printf(
+        "bus object size: dynamic %zu bytes, static %zu bytes\n",
+        sizeof(dynamic_bus),
+        sizeof(static_bus)
+    );
+    return 0;
+}
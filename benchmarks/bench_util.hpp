@@ -0,0 +1,64 @@
+/**
+ * @file bench_util.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ベンチマーク用の計測ヘルパー
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace gn10_can {
+namespace bench {
+
+/**
+ * @brief 値を最適化で消されないようにする
+ *
+ * @tparam T 値の型
+ * @param value 保持したい値
+ */
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief 処理を繰り返し実行し、1回あたりの平均時間[ns]を返す
+ *
+ * @tparam Func 計測する処理
+ * @param iterations 繰り返し回数
+ * @param func 計測する処理（引数に繰り返しインデックスを受け取る）
+ * @return double 1回あたりの平均時間[ns]
+ */
+template <typename Func>
+double measure_ns_per_op(std::size_t iterations, Func&& func)
+{
+    // キャッシュ・分岐予測を温めるための予備実行
+    for (std::size_t idx = 0; idx < iterations / 10; ++idx) {
+        func(idx);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < iterations; ++idx) {
+        func(idx);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    auto elapsed_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return elapsed_ns / static_cast<double>(iterations);
+}
+
+}  // namespace bench
+}  // namespace gn10_can
@@ -0,0 +1,157 @@
+/**
+ * @file bench_zero_copy.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信リングのフレームをコピーして配送する場合と、リング上のまま配送する場合の比較
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "bench_util.hpp"
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/basic_device.hpp"
+#include "gn10_can/drivers/buffered_driver.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+constexpr std::size_t FRAMES_PER_UPDATE = 64;
+constexpr std::size_t ITERATIONS        = 50000;
+
+/**
+ * @brief 受信リングから読み出す際にコピーしたバイト数を数えるドライバー
+ *
+ * ZeroCopy が false の場合は peek_receive() に未対応として振る舞い、バスに receive_batch()
+ * でのコピーをさせます（従来の受信経路）。
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Interface 実装するドライバーインターフェース
+ * @tparam ZeroCopy リング上のフレームを直接配送させるか
+ */
+template <typename Frame, typename Interface, bool ZeroCopy>
+class CountingRingDriver : public drivers::BasicBufferedDriver<Frame, Interface, 128>
+{
+    using Base = drivers::BasicBufferedDriver<Frame, Interface, 128>;
+
+public:
+    using Base::Base;
+
+    std::size_t receive_batch(Frame* out_frames, std::size_t max_frames) override
+    {
+        std::size_t received = Base::receive_batch(out_frames, max_frames);
+        copied_bytes += received * sizeof(Frame);
+        return received;
+    }
+
+    std::size_t peek_receive(Frame*& out_frames) override
+    {
+        if (!ZeroCopy) {
+            out_frames = nullptr;
+            return 0;
+        }
+        return Base::peek_receive(out_frames);
+    }
+
+    uint64_t copied_bytes = 0;
+};
+
+/**
+ * @brief 受信バイト数を数えるだけのデバイス
+ *
+ */
+template <typename Frame>
+class BenchDevice : public BasicDevice<Frame>
+{
+public:
+    explicit BenchDevice(IBus<Frame>& bus) : BasicDevice<Frame>(bus, id::DeviceType::MotorDriver, 1)
+    {
+    }
+
+    void on_receive(const Frame& frame) override
+    {
+        received_bytes_ += frame.dlc;
+    }
+
+    uint32_t received_bytes_ = 0;
+};
+
+/**
+ * @brief 計測結果
+ *
+ */
+struct Result {
+    double ns_per_frame;     // 1フレームあたりの処理時間[ns]
+    double bytes_per_frame;  // 1フレームあたりのリングからのコピー量[byte]
+};
+
+/**
+ * @brief 割り込み側で FRAMES_PER_UPDATE 個をリングへ積み、update() で配送する時間を計測する
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Interface ドライバーインターフェース
+ * @tparam ZeroCopy リング上のフレームを直接配送させるか
+ * @return Result 計測結果
+ */
+template <typename Frame, typename Interface, bool ZeroCopy>
+Result measure()
+{
+    BasicMockDriver<Frame, Interface> hardware;
+    CountingRingDriver<Frame, Interface, ZeroCopy> driver(hardware);
+    BasicBus<Frame, Interface> bus(driver);
+    BenchDevice<Frame> device(bus);
+
+    Frame frame;
+    frame.id  = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    frame.dlc = Frame::MAX_DLC;
+
+    double ns_per_update = bench::measure_ns_per_op(ITERATIONS, [&](std::size_t) {
+        for (std::size_t i = 0; i < FRAMES_PER_UPDATE; ++i) {
+            driver.push_from_isr(frame);
+        }
+        bus.update();
+    });
+
+    bench::do_not_optimize(device.received_bytes_);
+    double frames = static_cast<double>((ITERATIONS + ITERATIONS / 10) * FRAMES_PER_UPDATE);
+    Result result;
+    result.ns_per_frame    = ns_per_update / static_cast<double>(FRAMES_PER_UPDATE);
+    result.bytes_per_frame = static_cast<double>(driver.copied_bytes) / frames;
+    return result;
+}
+
+/**
+ * @brief 計測結果を1行表示する
+ *
+ */
+void print_row(const char* frame, const char* path, const Result& result)
+{
+    std::printf(
+        "%-8s %-10s %14.2f %16.0f %14.1f\n",
+        frame,
+        path,
+        result.ns_per_frame,
+        1e9 / result.ns_per_frame,
+        result.bytes_per_frame
+    );
+}
+
+}  // namespace
+
+int main()
+{
+    std::printf(
+        "%-8s %-10s %14s %16s %14s\n", "frame", "path", "ns/frame", "frames/s", "copied B/frame"
+    );
+    print_row("CAN", "copy", measure<CANFrame, drivers::ICANDriver, false>());
+    print_row("CAN", "zero-copy", measure<CANFrame, drivers::ICANDriver, true>());
+    print_row("CAN FD", "copy", measure<FDCANFrame, drivers::IFDCANDriver, false>());
+    print_row("CAN FD", "zero-copy", measure<FDCANFrame, drivers::IFDCANDriver, true>());
+    return 0;
+}
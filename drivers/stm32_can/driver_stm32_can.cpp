@@ -11,11 +11,11 @@ bool DriverSTM32CAN::init()
     filter.FilterMaskIdHigh     = 0;
     filter.FilterMaskIdLow      = 0;
     filter.FilterFIFOAssignment = CAN_RX_FIFO0;
-    filter.FilterBank           = 0;
+    filter.FilterBank           = first_filter_bank();
     filter.FilterMode           = CAN_FILTERMODE_IDMASK;
     filter.FilterScale          = CAN_FILTERSCALE_32BIT;
     filter.FilterActivation     = ENABLE;
-    filter.SlaveStartFilterBank = 14;
+    filter.SlaveStartFilterBank = FILTER_BANK_COUNT;
 
     if (HAL_CAN_ConfigFilter(hcan_, &filter) != HAL_OK) {
         return false;
@@ -80,9 +80,75 @@ bool DriverSTM32CAN::receive(CANFrame& out_frame)
     for (uint8_t i = 0; i < out_frame.dlc; ++i) {
         out_frame.data[i] = rx_data[i];
     }
+    if (time_source_ != nullptr) {
+        out_frame.set_timestamp(time_source_());
+    }
 
     return true;
 }
 
+std::size_t DriverSTM32CAN::max_acceptance_filters() const
+{
+    // 16bitスケールでは1バンクに ID/マスク の組を2つ設定できる
+    return FILTER_BANK_COUNT * 2;
+}
+
+bool DriverSTM32CAN::set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count)
+{
+    // 0個では全バンクが無効になり何も受信できなくなるため、設定を変えずに失敗とする
+    if (count == 0 || count > max_acceptance_filters()) {
+        return false;
+    }
+
+    // 16bitスケールのレジスタ配置: STID[15:5] RTR[4] IDE[3] EXID[2:0]
+    // マスクで RTR・IDE も比較し、標準IDのデータフレームだけを受信する
+    constexpr uint32_t STID_SHIFT   = 5;
+    constexpr uint32_t RTR_IDE_BITS = 0x18;
+
+    uint32_t first_bank = first_filter_bank();
+    for (uint32_t bank = 0; bank < FILTER_BANK_COUNT; bank++) {
+        std::size_t first  = bank * 2;
+        std::size_t second = first + 1;
+        if (second >= count) {
+            second = first;  // 奇数個の場合は同じフィルタを2つ設定する
+        }
+
+        CAN_FilterTypeDef filter;
+        filter.FilterFIFOAssignment = CAN_RX_FIFO0;
+        filter.FilterBank           = first_bank + bank;
+        filter.FilterMode           = CAN_FILTERMODE_IDMASK;
+        filter.FilterScale          = CAN_FILTERSCALE_16BIT;
+        filter.SlaveStartFilterBank = FILTER_BANK_COUNT;
+        if (first < count) {
+            filter.FilterIdHigh     = (filters[first].id & 0x7FF) << STID_SHIFT;
+            filter.FilterMaskIdHigh = ((filters[first].mask & 0x7FF) << STID_SHIFT) | RTR_IDE_BITS;
+            filter.FilterIdLow      = (filters[second].id & 0x7FF) << STID_SHIFT;
+            filter.FilterMaskIdLow  = ((filters[second].mask & 0x7FF) << STID_SHIFT) | RTR_IDE_BITS;
+            filter.FilterActivation = ENABLE;
+        } else {
+            filter.FilterIdHigh     = 0;
+            filter.FilterMaskIdHigh = 0;
+            filter.FilterIdLow      = 0;
+            filter.FilterMaskIdLow  = 0;
+            filter.FilterActivation = DISABLE;
+        }
+
+        if (HAL_CAN_ConfigFilter(hcan_, &filter) != HAL_OK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t DriverSTM32CAN::first_filter_bank() const
+{
+#if defined(CAN2)
+    if (hcan_->Instance == CAN2) {
+        return FILTER_BANK_COUNT;
+    }
+#endif
+    return 0;
+}
+
 }  // namespace drivers
 }  // namespace gn10_can
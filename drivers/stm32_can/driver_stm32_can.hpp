@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "gn10_can/drivers/can_driver_interface.hpp"
@@ -18,7 +19,7 @@
 namespace gn10_can {
 namespace drivers {
 
-class DriverSTM32CAN : public ICANDriver
+class DriverSTM32CAN final : public ICANDriver
 {
 public:
     DriverSTM32CAN(CAN_HandleTypeDef* hcan) : hcan_(hcan) {}
@@ -26,9 +27,38 @@ public:
     bool init();
     bool send(const CANFrame& frame) override;
     bool receive(CANFrame& out_frame) override;
+    std::size_t max_acceptance_filters() const override;
+    bool set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count) override;
+
+    /**
+     * @brief 受信時刻の取得元を設定する
+     *
+     * 設定すると、FIFOから読み出した時刻を受信フレームに記録します (ENABLE_FRAME_TIMESTAMP 有効時)。
+     * 受信割り込みから BufferedDriver 経由で読み出すと、割り込み時点の時刻になります。
+     *
+     * @param time_source 現在時刻[us]を返す関数
+     */
+    void set_time_source(TimeSourceUs time_source)
+    {
+        time_source_ = time_source;
+    }
 
 private:
+    // CAN1 はバンク 0〜13、CAN2 はバンク 14〜27 を使う (SlaveStartFilterBank = 14)
+    static constexpr uint32_t FILTER_BANK_COUNT = 14;  // 1つのCANが使うフィルタバンク数
+
+    /**
+     * @brief このハンドルが使うフィルタバンクの先頭番号を返す
+     *
+     * フィルタバンクは CAN1/CAN2 で共有されるため、CAN2 のハンドルで CAN1 のバンクを
+     * 書き換えないようにします。
+     *
+     * @return uint32_t CAN1 (単一CANの品種を含む) は 0、CAN2 は FILTER_BANK_COUNT
+     */
+    uint32_t first_filter_bank() const;
+
     CAN_HandleTypeDef* hcan_;
+    TimeSourceUs time_source_ = nullptr;  // 受信時刻の取得元
 };
 }  // namespace drivers
 }  // namespace gn10_can
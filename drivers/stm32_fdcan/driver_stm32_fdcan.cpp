@@ -25,7 +25,7 @@ bool DriverSTM32FDCAN::init()
     return true;
 }
 
-bool DriverSTM32FDCAN::send(const CANFrame& frame)
+bool DriverSTM32FDCAN::send(const FDCANFrame& frame)
 {
     FDCAN_TxHeaderTypeDef tx_header;
     if (frame.is_extended) {
@@ -33,12 +33,23 @@ bool DriverSTM32FDCAN::send(const CANFrame& frame)
     } else {
         tx_header.IdType = FDCAN_STANDARD_ID;
     }
+    // 8byteを超えるフレームはクラシックCANでは送れないため、FD フォーマットにする
+    bool is_fd = frame.is_fd || frame.dlc > CANFrame::MAX_DLC;
+    if (is_fd) {
+        tx_header.FDFormat = FDCAN_FD_CAN;
+    } else {
+        tx_header.FDFormat = FDCAN_CLASSIC_CAN;
+    }
+    if (is_fd && frame.bit_rate_switch) {
+        tx_header.BitRateSwitch = FDCAN_BRS_ON;
+    } else {
+        tx_header.BitRateSwitch = FDCAN_BRS_OFF;
+    }
+    // FDCAN_DLC_BYTES_n は DLCコードの定数倍 (G4 はそのまま、H7 は16bit左シフト)
     tx_header.Identifier          = frame.id;
     tx_header.TxFrameType         = FDCAN_DATA_FRAME;
-    tx_header.DataLength          = frame.dlc;
+    tx_header.DataLength          = FDCANFrame::to_dlc_code(frame.dlc) * FDCAN_DLC_BYTES_1;
     tx_header.ErrorStateIndicator = FDCAN_ESI_ACTIVE;
-    tx_header.BitRateSwitch       = FDCAN_BRS_OFF;
-    tx_header.FDFormat            = FDCAN_CLASSIC_CAN;
     tx_header.TxEventFifoControl  = FDCAN_NO_TX_EVENTS;
     tx_header.MessageMarker       = 0;
 
@@ -50,25 +61,88 @@ bool DriverSTM32FDCAN::send(const CANFrame& frame)
     return true;
 }
 
-bool DriverSTM32FDCAN::receive(CANFrame& out_frame)
+bool DriverSTM32FDCAN::receive(FDCANFrame& out_frame)
 {
     FDCAN_RxHeaderTypeDef rx_header;
-    uint8_t rx_data[8];
 
-    if (HAL_FDCAN_GetRxMessage(hfdcan_, FDCAN_RX_FIFO0, &rx_header, rx_data) != HAL_OK) {
+    // HAL は DLC の長さ (最大64byte) をそのまま書き込むため、フレームのデータ部へ直接受け取る
+    if (HAL_FDCAN_GetRxMessage(hfdcan_, FDCAN_RX_FIFO0, &rx_header, out_frame.data.data()) !=
+        HAL_OK) {
         return false;
     }
 
-    out_frame.id          = rx_header.Identifier;
-    out_frame.dlc         = rx_header.DataLength;
-    out_frame.is_extended = (rx_header.IdType == FDCAN_EXTENDED_ID);
+    out_frame.id              = rx_header.Identifier;
+    out_frame.is_extended     = (rx_header.IdType == FDCAN_EXTENDED_ID);
+    out_frame.is_fd           = (rx_header.FDFormat == FDCAN_FD_CAN);
+    out_frame.bit_rate_switch = (rx_header.BitRateSwitch == FDCAN_BRS_ON);
 
-    for (uint8_t i = 0; i < out_frame.dlc; ++i) {
-        out_frame.data[i] = rx_data[i];
+    uint8_t dlc_code = static_cast<uint8_t>(rx_header.DataLength / FDCAN_DLC_BYTES_1);
+    if (out_frame.is_fd) {
+        out_frame.dlc = static_cast<uint8_t>(FDCANFrame::from_dlc_code(dlc_code));
+    } else {
+        // クラシックCANの DLC 9〜15 は8byte
+        out_frame.dlc = static_cast<uint8_t>(CANFrame::from_dlc_code(dlc_code));
+    }
+    if (time_source_ != nullptr) {
+        TimestampUs now = time_source_();
+        if (counter_tick_ns_ > 0) {
+            // 16bitカウンタの現在値と受信時の値の差が、FIFOで待たされた時間
+            uint32_t counter      = HAL_FDCAN_GetTimestampCounter(hfdcan_);
+            uint16_t waited_ticks = static_cast<uint16_t>(counter - rx_header.RxTimestamp);
+            now -= static_cast<TimestampUs>(uint64_t{waited_ticks} * counter_tick_ns_ / 1000);
+        }
+        out_frame.set_timestamp(now);
     }
 
     return true;
 }
 
+std::size_t DriverSTM32FDCAN::max_acceptance_filters() const
+{
+    // CubeMX で設定した標準IDフィルタ要素数 (最大28)
+    return hfdcan_->Init.StdFiltersNbr;
+}
+
+bool DriverSTM32FDCAN::set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count)
+{
+    // 0個ではグローバルフィルタで全フレームを破棄してしまうため、設定を変えずに失敗とする
+    std::size_t max_filters = max_acceptance_filters();
+    if (count == 0 || count > max_filters) {
+        return false;
+    }
+
+    // グローバルフィルタは停止中しか設定できないため、一度停止する
+    if (HAL_FDCAN_Stop(hfdcan_) != HAL_OK) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < max_filters; i++) {
+        FDCAN_FilterTypeDef filter;
+        filter.IdType      = FDCAN_STANDARD_ID;
+        filter.FilterIndex = i;
+        filter.FilterType  = FDCAN_FILTER_MASK;
+        if (i < count) {
+            filter.FilterConfig = FDCAN_FILTER_TO_RXFIFO0;
+            filter.FilterID1    = filters[i].id;
+            filter.FilterID2    = filters[i].mask;
+        } else {
+            filter.FilterConfig = FDCAN_FILTER_DISABLE;
+            filter.FilterID1    = 0x000;
+            filter.FilterID2    = 0x000;
+        }
+        if (HAL_FDCAN_ConfigFilter(hfdcan_, &filter) != HAL_OK) {
+            return false;
+        }
+    }
+
+    // どのフィルタにも一致しないフレーム・リモートフレームは破棄する
+    if (HAL_FDCAN_ConfigGlobalFilter(
+            hfdcan_, FDCAN_REJECT, FDCAN_REJECT, FDCAN_REJECT_REMOTE, FDCAN_REJECT_REMOTE
+        ) != HAL_OK) {
+        return false;
+    }
+    return HAL_FDCAN_Start(hfdcan_) == HAL_OK;
+}
+
 }  // namespace drivers
 }  // namespace gn10_can
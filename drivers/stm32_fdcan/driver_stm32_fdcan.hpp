@@ -10,23 +10,53 @@
  */
 #pragma once
 
-#include "gn10_can/drivers/can_driver_interface.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/drivers/fdcan_driver_interface.hpp"
 #include "main.h"
 
 namespace gn10_can {
 namespace drivers {
 
-class DriverSTM32FDCAN : public ICANDriver
+/**
+ * @brief STM32 FDCAN ペリフェラルのドライバ
+ *
+ * フレームの is_fd / bit_rate_switch を送信ヘッダの FDFormat / BitRateSwitch に反映し、
+ * dlc は DLCコードに変換して DataLength に設定します。CAN FD フォーマットと BRS を使う場合は、
+ * CubeMX で FrameFormat を FD (BRS を使う場合は FD_BRS) にし、データビットレートを設定してください。
+ */
+class DriverSTM32FDCAN final : public IFDCANDriver
 {
 public:
     DriverSTM32FDCAN(FDCAN_HandleTypeDef* hfdcan) : hfdcan_(hfdcan) {}
 
     bool init();
-    bool send(const CANFrame& frame) override;
-    bool receive(CANFrame& out_frame) override;
+    bool send(const FDCANFrame& frame) override;
+    bool receive(FDCANFrame& out_frame) override;
+    std::size_t max_acceptance_filters() const override;
+    bool set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count) override;
+
+    /**
+     * @brief 受信時刻の取得元を設定する
+     *
+     * 設定すると、受信フレームに受信時刻を記録します (ENABLE_FRAME_TIMESTAMP 有効時)。
+     * counter_tick_ns を指定した場合は、ハードウェアのタイムスタンプカウンタ (CubeMX で有効化) を使い、
+     * FIFOで待たされた時間を差し引いた受信完了時刻を記録します。
+     *
+     * @param time_source 現在時刻[us]を返す関数
+     * @param counter_tick_ns タイムスタンプカウンタ1カウントの時間[ns]（0の場合は読み出し時刻を記録）
+     */
+    void set_time_source(TimeSourceUs time_source, uint32_t counter_tick_ns = 0)
+    {
+        time_source_     = time_source;
+        counter_tick_ns_ = counter_tick_ns;
+    }
 
 private:
     FDCAN_HandleTypeDef* hfdcan_;
+    TimeSourceUs time_source_ = nullptr;  // 受信時刻の取得元
+    uint32_t counter_tick_ns_ = 0;        // タイムスタンプカウンタ1カウントの時間[ns]
 };
 }  // namespace drivers
 }  // namespace gn10_can
@@ -0,0 +1,67 @@
+/**
+ * @file acceptance_filter.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 接続デバイスからハードウェア受信フィルタ (ID/マスク) を生成する機能のヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gn10_can {
+
+/**
+ * @brief 1つのドライバーに設定できる受信フィルタ数の上限
+ *
+ * bxCAN (16bitスケールで14バンク×2) と FDCAN (標準IDフィルタ要素28個) の大きい方に合わせています。
+ */
+static constexpr std::size_t MAX_ACCEPTANCE_FILTERS = 28;
+
+/**
+ * @brief 標準ID用の受信フィルタ (ID/マスク方式)
+ *
+ * `(frame_id & mask) == (id & mask)` のフレームを受信します。
+ */
+struct AcceptanceFilter {
+    uint32_t id   = 0;  // 比較するID (11bit)
+    uint32_t mask = 0;  // 比較するビット (1: 比較する, 0: 無視する)
+
+    /**
+     * @brief 標準IDのフレームを受信するか判定する
+     *
+     * @param std_id 標準ID
+     * @return true 受信する
+     * @return false 受信しない
+     */
+    bool accepts(uint32_t std_id) const
+    {
+        return (std_id & mask) == (id & mask);
+    }
+};
+
+/**
+ * @brief ルーティングIDの集合を全て受信する、指定数以下の受信フィルタを生成する
+ *
+ * まず各ルーティングIDに完全一致するフィルタを作り、フィルタ数が max_filters を超える間は
+ * 「統合すると余分に受信してしまうルーティングIDの数」が最も少ない2つを統合します。
+ * コマンドのビットは常に無視します（コマンドの振り分けはデバイスのコマンドテーブルで行う）。
+ *
+ * @param routing_ids 受信したいルーティングIDの配列（重複可）
+ * @param id_count ルーティングIDの数
+ * @param out_filters 生成したフィルタの格納先（max_filters 個以上の領域）
+ * @param max_filters ハードウェアで使えるフィルタ数
+ * @return std::size_t 生成したフィルタ数（max_filters が0の場合は0）
+ */
+std::size_t build_acceptance_filters(
+    const uint32_t* routing_ids,
+    std::size_t id_count,
+    AcceptanceFilter* out_filters,
+    std::size_t max_filters
+);
+
+}  // namespace gn10_can
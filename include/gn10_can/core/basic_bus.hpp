@@ -0,0 +1,779 @@
+/**
+ * @file basic_bus.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief
+ * フレーム型・ドライバー型・容量で共通化したバスクラス。デバイスの接続(Attach)と、メッセージのルーティング(Dispatch)を担当します。
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/acceptance_filter.hpp"
+#include "gn10_can/core/basic_device.hpp"
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/bus_interface.hpp"
+#include "gn10_can/core/bus_stats.hpp"
+#include "gn10_can/core/device_slots.hpp"
+#include "gn10_can/core/frame_builder.hpp"
+#include "gn10_can/core/latency_profile.hpp"
+#include "gn10_can/core/routing_table.hpp"
+#include "gn10_can/core/timestamp.hpp"
+#include "gn10_can/core/tx_queue.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 処理量を制限した update() の結果
+ *
+ */
+struct UpdateResult {
+    std::size_t processed_frames = 0;      // 配送したフレーム数
+    bool more_pending            = false;  // 予算切れで未処理の受信フレームが残っているか
+};
+
+/**
+ * @brief
+ * 物理的なCAN/FDCANバスをソフトウェア上で表現したクラス。デバイスの接続(Attach)と、メッセージのルーティング(Dispatch)を担当します。
+ *
+ * Driver にインターフェース (ICANDriver 等) を指定すると従来通り仮想関数経由で通信し、
+ * 具体的なドライバー型 (final クラス) を指定すると `driver_.receive()` / `driver_.send()`
+ * が静的に解決されインライン化されます（ドライバーが1種類しかないマイコン向け）。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam Driver `send()` / `receive_batch()` / `peek_receive()` などを持つドライバーの型
+ * (ICANDriver / IFDCANDriver かその派生クラス)
+ * @tparam Capacity 最大登録デバイス数
+ * @tparam TxQueueDepth ソフトウェア送信キューの段数（0でキューなし、ドライバーへ直接送信）
+ * @tparam RxBatchSize receive_batch() で1度に読み出す最大フレーム数（受信バッファの段数）
+ */
+template <
+    typename Frame,
+    typename Driver,
+    std::size_t Capacity     = 16,
+    std::size_t TxQueueDepth = 8,
+    std::size_t RxBatchSize  = 8>
+class BasicBus : public IBus<Frame>
+{
+public:
+    using FrameType  = Frame;
+    using DriverType = Driver;
+    using Device     = BasicDevice<Frame>;
+    using Tap        = BasicTap<Frame>;
+
+    using IBus<Frame>::send_frame;
+
+    static constexpr std::size_t MAX_DEVICES    = Capacity;      // 最大登録デバイス数
+    static constexpr std::size_t TX_QUEUE_DEPTH = TxQueueDepth;  // ソフトウェア送信キューの段数
+    static constexpr std::size_t RX_BATCH_SIZE  = RxBatchSize;   // 1度に読み出す最大受信フレーム数
+
+    static_assert(RxBatchSize > 0, "RxBatchSize must be at least 1");
+
+    /**
+     * @brief バスクラスのコンストラクタ
+     *
+     * @param driver ドライバーの参照
+     */
+    explicit BasicBus(Driver& driver) : driver_(driver) {}
+
+    /**
+     * @brief CANパケットの受信とデバイスへのルーティング処理
+     *
+     * 受信データを receive_batch() でまとめて読み込み（ドライバーが peek_receive() に対応していれば
+     * ドライバーの受信バッファ上のまま）、適切なデバイスに渡します。
+     * 先にソフトウェア送信キューに溜まったフレームの送信 (flush) も行います。
+     */
+    void update()
+    {
+        uint32_t started = latency_begin();
+        flush_queue();
+        std::size_t processed = 0;
+        const Frame* frame    = next_frame();
+        while (frame != nullptr) {
+            dispatch(*frame);
+            processed++;
+            frame = next_frame();
+        }
+        finish_update(processed);
+        latency_end(LatencyProfile::UPDATE, started);
+    }
+
+    /**
+     * @brief 最大フレーム数を指定したCANパケットの受信とルーティング処理
+     *
+     * 受信が続いても max_frames 個を配送した時点で戻るため、制御ループの処理時間を制限できます。
+     * 残りのフレームは次回の呼び出しで処理されます。
+     *
+     * @param max_frames 1回の呼び出しで配送する最大フレーム数
+     * @return UpdateResult 配送したフレーム数と未処理フレームの有無
+     */
+    UpdateResult update(std::size_t max_frames)
+    {
+        uint32_t started = latency_begin();
+        flush_queue();
+        UpdateResult result;
+        while (result.processed_frames < max_frames) {
+            const Frame* frame = next_frame();
+            if (frame == nullptr) {
+                break;
+            }
+            dispatch(*frame);
+            result.processed_frames++;
+        }
+        if (result.processed_frames == max_frames) {
+            result.more_pending = peek_pending();
+        }
+        finish_update(result.processed_frames);
+        latency_end(LatencyProfile::UPDATE, started);
+        return result;
+    }
+
+    /**
+     * @brief 期限を指定したCANパケットの受信とルーティング処理
+     *
+     * 各フレームの配送前に `Clock::now()` を確認し、期限を過ぎていれば戻ります。
+     * Clock は std::chrono のクロック要件 (`now()` と `time_point`) を満たす型であれば、
+     * HAL_GetTick() 等を元にした独自クロックでも構いません。
+     *
+     * @tparam Clock 時刻の取得に使うクロック
+     * @tparam Duration time_point の分解能
+     * @param deadline 処理を打ち切る時刻
+     * @return UpdateResult 配送したフレーム数と未処理フレームの有無
+     */
+    template <typename Clock, typename Duration>
+    UpdateResult update_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        uint32_t started = latency_begin();
+        flush_queue();
+        UpdateResult result;
+        while (true) {
+            if (Clock::now() >= deadline) {
+                result.more_pending = peek_pending();
+                break;
+            }
+            const Frame* frame = next_frame();
+            if (frame == nullptr) {
+                break;
+            }
+            dispatch(*frame);
+            result.processed_frames++;
+        }
+        finish_update(result.processed_frames);
+        latency_end(LatencyProfile::UPDATE, started);
+        return result;
+    }
+
+    /**
+     * @brief フレーム送信関数
+     *
+     * ハードウェアの送信メールボックス・FIFOが満杯の場合は、CAN IDの優先度順に並ぶ
+     * ソフトウェア送信キューに積み、flush() で空きができ次第送信します。
+     * mode が Coalesce の場合、送信待ちの同じIDのフレームがあればそれを上書きします。
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功、またはキューに積んだ（上書きを含む）
+     * @return false 送信失敗（キューなし、またはキュー満杯で破棄）
+     */
+    bool send_frame(const Frame& frame, TxMode mode) override
+    {
+        uint32_t started = latency_begin();
+        bool accepted    = send_or_queue(frame, mode);
+        if (!accepted) {
+            stats_.work().tx_failures++;
+        }
+        stats_.publish();
+        latency_end(LatencyProfile::SEND, started);
+        return accepted;
+    }
+
+    /**
+     * @brief ソフトウェア送信キューのフレームを、ハードウェアが受け付ける限り優先度順に送信する
+     *
+     * update() の先頭でも呼ばれます。TX完了割り込みでフラグを立て、メインループから呼ぶと
+     * 空きができた直後に送信できます。send_frame() と同じ実行コンテキストから呼んでください。
+     *
+     * @return std::size_t 送信したフレーム数
+     */
+    std::size_t flush()
+    {
+        std::size_t sent = flush_queue();
+        stats_.publish();
+        return sent;
+    }
+
+    /**
+     * @brief 接続中のデバイスだけを受信するハードウェア受信フィルタをドライバーに設定する
+     *
+     * 全デバイスを生成した後に呼び出してください。フィルタ数がハードウェアの上限を超える場合は
+     * 余分な受信が最も少なくなるようにフィルタを統合します（build_acceptance_filters() 参照）。
+     * デバイスを追加・削除した場合は再度呼び出してください。
+     *
+     * @return true 設定成功
+     * @return false ドライバーが受信フィルタに未対応、デバイスが未接続、または設定失敗
+     */
+    bool apply_acceptance_filters()
+    {
+        std::size_t max_filters = driver_.max_acceptance_filters();
+        if (max_filters > MAX_ACCEPTANCE_FILTERS) {
+            max_filters = MAX_ACCEPTANCE_FILTERS;
+        }
+        if (max_filters == 0) {
+            return false;
+        }
+
+        std::array<uint32_t, Capacity> routing_ids{};
+        for (std::size_t i = 0; i < devices_.size(); i++) {
+            routing_ids[i] = devices_[i]->get_routing_id();
+        }
+        std::array<AcceptanceFilter, MAX_ACCEPTANCE_FILTERS> filters{};
+        std::size_t count = build_acceptance_filters(
+            routing_ids.data(), devices_.size(), filters.data(), max_filters
+        );
+        if (count == 0) {
+            return false;  // デバイスが無いときに全フレームを破棄する設定にはしない
+        }
+        return driver_.set_acceptance_filters(filters.data(), count);
+    }
+
+    /**
+     * @brief 全ての送受信フレームを受け取るタップを登録する
+     *
+     * 受信フレームは配送先の有無によらず、送信フレームはドライバーが受け付けた時点で通知されます。
+     * タップは破棄時に自動的に登録解除されます。タップがなければ通知のコストはポインタの確認1回です。
+     *
+     * @param tap 登録するタップ
+     * @return true 登録成功
+     * @return false 登録失敗（既にいずれかのバスに登録済み）
+     */
+    bool add_tap(Tap& tap)
+    {
+        return taps_.add(tap);
+    }
+
+    /**
+     * @brief タップの登録を解除する
+     *
+     * @param tap 登録解除するタップ
+     */
+    void remove_tap(Tap& tap)
+    {
+        taps_.remove(tap);
+    }
+
+    /**
+     * @brief 登録されているデバイス数を取得する
+     *
+     * @return std::size_t デバイス数
+     */
+    std::size_t device_count() const
+    {
+        return devices_.size();
+    }
+
+    /**
+     * @brief ソフトウェア送信キューの統計情報を取得する
+     *
+     * @return TxQueueStats 破棄数・上書き数・キュー深さ・待ち時間などの統計情報
+     */
+    TxQueueStats tx_queue_stats() const
+    {
+        return tx_queue_.stats();
+    }
+
+    /**
+     * @brief バス全体の送受信統計を取得する（update() を呼ぶスレッド以外からも呼び出し可能）
+     *
+     * 値は update() / send_frame() / flush() の終わりにまとめて更新されるため、
+     * 各項目は同じ時点のものです。デバイスごとの統計は BasicDevice::stats() で取得します。
+     * 公開の途中で待つことがあるため、割り込みからは try_stats() を使ってください。
+     *
+     * @return BusStats 統計のスナップショット
+     */
+    BusStats stats() const
+    {
+        return stats_.snapshot();
+    }
+
+    /**
+     * @brief バス全体の送受信統計の取得を試みる（割り込みを含むどのコンテキストからも呼び出し可能）
+     *
+     * 統計の公開中に割り込んだ場合は待たずに失敗します。
+     *
+     * @param out 統計の格納先（失敗時は変更しない）
+     * @return true 取得成功
+     * @return false 公開と重なったため取得できなかった
+     */
+    bool try_stats(BusStats& out) const
+    {
+        return stats_.try_snapshot(out);
+    }
+
+#if defined(GN10_CAN_ENABLE_LATENCY_PROFILE)
+    /**
+     * @brief 処理時間の計測に使うカウンタを設定する
+     *
+     * 設定するまで処理時間は記録されません。
+     * Cortex-M では utils::dwt_cycle_counter、Linux では utils::monotonic_ns が使えます。
+     *
+     * @param counter カウンタの現在値を返す関数
+     */
+    void set_cycle_counter(CycleCounter counter)
+    {
+        cycle_counter_ = counter;
+    }
+
+    /**
+     * @brief 処理時間のヒストグラムを取得する（update() と同じコンテキストから呼び出すこと）
+     *
+     * @return const LatencyProfile& update() / send_frame() / デバイスの種類ごとの受信処理の処理時間
+     */
+    const LatencyProfile& latency_profile() const
+    {
+        return latency_profile_;
+    }
+
+    /**
+     * @brief 処理時間のヒストグラムを消去する
+     *
+     */
+    void reset_latency_profile()
+    {
+        latency_profile_.reset();
+    }
+#endif
+
+    /**
+     * @brief 時刻の取得元を設定する（送信キューの待ち時間・受信時刻・タップの時刻に使用）
+     *
+     * 設定しない場合、時刻は常に0として扱われます。
+     *
+     * @param time_source 現在時刻[us]を返す関数
+     */
+    void set_time_source(TimeSourceUs time_source)
+    {
+        time_source_ = time_source;
+    }
+
+    /**
+     * @brief 現在時刻を取得する
+     *
+     * @return TimestampUs 現在時刻[us]（取得元が未設定の場合は0）
+     */
+    TimestampUs now_us() const
+    {
+        if (time_source_ == nullptr) {
+            return 0;
+        }
+        return time_source_();
+    }
+
+private:
+    /**
+     * @brief デバイスをバスに接続する (RAII内部利用)
+     *
+     * BasicDeviceのコンストラクタから自動的に呼び出されます。結果は BasicDevice::is_attached() で確認できます。
+     *
+     * @param device 登録するデバイスへのポインタ
+     * @return true 登録成功
+     * @return false 登録失敗（デバイス数上限、またはルーティングIDが範囲外）
+     */
+    bool attach(Device* device) override
+    {
+        if (device == nullptr || devices_.full()) {
+            return false;
+        }
+        if (!routing_table_.insert(device)) {
+            return false;
+        }
+        devices_.insert(device);
+        return true;
+    }
+
+    /**
+     * @brief デバイスをバスから切断する (RAII内部利用)
+     *
+     * BasicDeviceのデストラクタから、登録に成功したデバイスについてのみ呼び出されます。
+     * デバイスが保持する位置を使うため、登録数によらず O(1) です。
+     *
+     * @param device 登録解除するデバイスへのポインタ
+     */
+    void detach(Device* device) override
+    {
+        // 受信処理の中から解除された場合、dispatch() が解除したデバイスに触れないようにする
+        if (device == dispatch_current_) {
+            dispatch_current_ = nullptr;
+        }
+        if (device == dispatch_next_) {
+            dispatch_next_ = routing_table_.next(device);
+        }
+        routing_table_.remove(device);
+        devices_.remove(device);
+        if (device->has_pending_stats()) {
+            // 受信処理中に破棄された場合、公開待ちから外す
+            for (std::size_t i = 0; i < stats_pending_count_; ++i) {
+                if (stats_pending_[i] == device) {
+                    stats_pending_[i] = stats_pending_[--stats_pending_count_];
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief デバイスがデータ部を解釈できなかったことを統計に計上する
+     *
+     */
+    void count_parse_failure() override
+    {
+        stats_.work().parse_failures++;
+    }
+
+    /**
+     * @brief ビルダーが直接書き込む送信フレームの領域を確保する
+     *
+     * @return TxSlot<Frame> バスが持つ書き込み領域（全てビルダーが使用中の場合は空）
+     */
+    TxSlot<Frame> acquire_tx_slot() override
+    {
+        return tx_staging_.acquire();
+    }
+
+    /**
+     * @brief 書き込み領域のフレームを写さずに send_frame() と同じ経路で送信し、領域を返却する
+     *
+     * 送信中（タップの通知中など）に別のビルダーが確保した場合は、プールの別の領域を使う。
+     *
+     * @param slot 書き込みを終えた領域
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功、またはキューに積んだ
+     * @return false 送信失敗
+     */
+    bool commit_tx_slot(const TxSlot<Frame>& slot, TxMode mode) override
+    {
+        bool sent = BasicBus::send_frame(*slot.frame, mode);
+        tx_staging_.release(slot);
+        return sent;
+    }
+
+    /**
+     * @brief 書き込み領域を送信せずに返却する
+     *
+     * @param slot 確保した領域
+     */
+    void cancel_tx_slot(const TxSlot<Frame>& slot) override
+    {
+        tx_staging_.release(slot);
+    }
+
+    /**
+     * @brief ハードウェアへ直接送信するか、ソフトウェア送信キューに積む
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功、またはキューに積んだ
+     * @return false 送信失敗
+     */
+    bool send_or_queue(const Frame& frame, TxMode mode)
+    {
+        if constexpr (TxQueueDepth == 0) {
+            (void)mode;
+            if (!driver_.send(frame)) {
+                return false;
+            }
+            on_sent(frame);
+            return true;
+        } else {
+            // 送信待ちがなければ直接ハードウェアへ（待ちがあれば優先度順を守るためキューへ）
+            if (tx_queue_.empty() && driver_.send(frame)) {
+                on_sent(frame);
+                return true;
+            }
+            bool queued = tx_queue_.push(frame, now_us(), mode);
+            flush_queue();
+            return queued;
+        }
+    }
+
+    /**
+     * @brief ソフトウェア送信キューのフレームを、ハードウェアが受け付ける限り優先度順に送信する
+     *
+     * キューは優先度順にフレームを連続して保持するため、送信待ちの全フレームを
+     * send_batch() へ1度に渡します。ドライバーは先頭から受け付けた数を返します。
+     *
+     * @return std::size_t 送信したフレーム数
+     */
+    std::size_t flush_queue()
+    {
+        std::size_t sent = 0;
+        if constexpr (TxQueueDepth > 0) {
+            if (tx_queue_.empty()) {
+                return 0;
+            }
+            sent = driver_.send_batch(tx_queue_.frames(), tx_queue_.size());
+            for (std::size_t i = 0; i < sent; i++) {
+                on_sent(tx_queue_.frames()[i]);
+            }
+            tx_queue_.pop(now_us(), sent);
+        }
+        return sent;
+    }
+
+    /**
+     * @brief ドライバーに送信を受け付けられたフレームを統計に計上し、タップに通知する
+     *
+     * @param frame 送信したフレーム
+     */
+    void on_sent(const Frame& frame)
+    {
+        stats_.work().tx_frames++;
+        notify_taps(frame, TapDirection::Tx);
+    }
+
+    /**
+     * @brief update() の終わりに、配送数の最大値を更新して統計を公開する
+     *
+     * @param processed 今回配送したフレーム数
+     */
+    void finish_update(std::size_t processed)
+    {
+        release_borrowed();
+        BusStats& work = stats_.work();
+        if (processed > work.max_frames_per_update) {
+            work.max_frames_per_update = static_cast<uint32_t>(processed);
+        }
+        stats_.publish();
+
+        // 受信したデバイスの統計は、フレームごとではなくここで1度だけ公開する
+        for (std::size_t i = 0; i < stats_pending_count_; ++i) {
+            stats_pending_[i]->publish_stats();
+        }
+        stats_pending_count_ = 0;
+    }
+
+    /**
+     * @brief 未処理の受信フレームがなければ、ドライバーから最大 RxBatchSize 個を取得する
+     *
+     * ドライバーが peek_receive() に対応していれば、受信バッファ上のフレームをコピーせずに借ります。
+     * 対応していなければ receive_batch() で rx_buffer_ へまとめて読み込みます。
+     * タイムスタンプが有効な場合、ドライバーが受信時刻を設定しなかったフレームには
+     * 取得した時刻を設定します。
+     *
+     * @return true 未処理の受信フレームがある
+     * @return false 受信フレームはない
+     */
+    bool fill_rx_buffer()
+    {
+        if (rx_head_ < rx_count_ || rx_borrowed_head_ < rx_borrowed_count_) {
+            return true;
+        }
+        release_borrowed();
+
+        rx_borrowed_count_ = driver_.peek_receive(rx_borrowed_);
+        if (rx_borrowed_count_ > 0) {
+            if (rx_borrowed_count_ > RxBatchSize) {
+                rx_borrowed_count_ = RxBatchSize;
+            }
+            stamp_received(rx_borrowed_, rx_borrowed_count_);
+            return true;
+        }
+
+        rx_head_  = 0;
+        rx_count_ = driver_.receive_batch(rx_buffer_.data(), RxBatchSize);
+        stamp_received(rx_buffer_.data(), rx_count_);
+        return rx_count_ > 0;
+    }
+
+    /**
+     * @brief ドライバーが受信時刻を設定しなかったフレームに、現在時刻を設定する
+     *
+     * @param frames 受信フレームの配列
+     * @param count フレーム数
+     */
+    void stamp_received(Frame* frames, std::size_t count)
+    {
+        if constexpr (Frame::HAS_TIMESTAMP) {
+            if (count > 0 && time_source_ != nullptr) {
+                TimestampUs now = time_source_();
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (frames[i].timestamp() == 0) {
+                        frames[i].set_timestamp(now);
+                    }
+                }
+            }
+        } else {
+            (void)frames;
+            (void)count;
+        }
+    }
+
+    /**
+     * @brief ドライバーから借りた受信フレームのうち、配送済みのものを返却する
+     *
+     * 配送していないフレームはドライバーに残り、次の peek_receive() で再び借ります。
+     */
+    void release_borrowed()
+    {
+        if (rx_borrowed_head_ > 0) {
+            driver_.release_receive(rx_borrowed_head_);
+        }
+        rx_borrowed_head_  = 0;
+        rx_borrowed_count_ = 0;
+    }
+
+    /**
+     * @brief 次の受信フレームを取得する
+     *
+     * フレームはコピーせず、rx_buffer_ またはドライバーの受信バッファ内を指すポインタで返します
+     * （次の呼び出し・update() の終わりまで有効）。
+     *
+     * @return const Frame* 受信フレーム（受信なしの場合は nullptr）
+     */
+    const Frame* next_frame()
+    {
+        if (!fill_rx_buffer()) {
+            return nullptr;
+        }
+        if (rx_borrowed_head_ < rx_borrowed_count_) {
+            return &rx_borrowed_[rx_borrowed_head_++];
+        }
+        return &rx_buffer_[rx_head_++];
+    }
+
+    /**
+     * @brief 未処理の受信フレームがあるか確認する
+     *
+     * peek_receive() に対応したドライバーからは取り出さずに確認します。
+     * 対応していなければ、受信バッファが空の場合に先読みして保持します。
+     *
+     * @return true 未処理の受信フレームがある
+     * @return false 受信フレームはない
+     */
+    bool peek_pending()
+    {
+        return fill_rx_buffer();
+    }
+
+    /**
+     * @brief 受信したフレームを適切なデバイスに配送する
+     *
+     * @param frame 受信フレーム
+     */
+    void dispatch(const Frame& frame)
+    {
+        stats_.work().rx_frames++;
+        notify_taps(frame, TapDirection::Rx);
+
+        // ルーティングIDで直接テーブルを引き、同じIDを持つデバイスへ登録順に配送する
+        uint32_t routing_id = frame.get_routing_id();
+        Device* device      = routing_table_.find(routing_id);
+        if (device == nullptr) {
+            stats_.work().unrouted_frames++;
+            return;
+        }
+        uint8_t command  = static_cast<uint8_t>(frame.id & (Device::COMMAND_COUNT - 1));
+        std::size_t site = routing_id >> id::BIT_WIDTH_DEV_ID;
+        // 受信処理中にデバイスが自身や後続のデバイスを解除・破棄しても辿れるよう、
+        // 配送中と次のデバイスは detach() が書き換える。deliver() の後は device に触れない
+        while (device != nullptr) {
+            dispatch_current_ = device;
+            dispatch_next_    = routing_table_.next(device);
+            uint32_t started  = latency_begin();
+            bool first        = device->deliver(frame, command);
+            if (first && dispatch_current_ != nullptr) {
+                stats_pending_[stats_pending_count_++] = device;
+            }
+            latency_end(site, started);
+            device = dispatch_next_;
+        }
+        dispatch_current_ = nullptr;
+    }
+
+    /**
+     * @brief 処理時間の計測を始める
+     *
+     * `GN10_CAN_ENABLE_LATENCY_PROFILE` が未定義の場合は何もせず、呼び出しごと最適化で消えます。
+     *
+     * @return uint32_t 計測開始時のカウンタの値
+     */
+    uint32_t latency_begin() const
+    {
+#if defined(GN10_CAN_ENABLE_LATENCY_PROFILE)
+        if (cycle_counter_ != nullptr) {
+            return cycle_counter_();
+        }
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief 処理時間の計測を終え、ヒストグラムに記録する
+     *
+     * @param site 記録先の番号 (LatencyProfile::at() 参照)
+     * @param started latency_begin() の戻り値
+     */
+    void latency_end(std::size_t site, uint32_t started)
+    {
+#if defined(GN10_CAN_ENABLE_LATENCY_PROFILE)
+        if (cycle_counter_ != nullptr) {
+            latency_profile_.at(site).record(cycle_counter_() - started);
+        }
+#else
+        (void)site;
+        (void)started;
+#endif
+    }
+
+    /**
+     * @brief タップが登録されていれば送受信フレームを通知する
+     *
+     * フレームに受信時刻が設定されていればその時刻を、なければ現在時刻を渡します。
+     * 受信フレームは配送した時刻ではなく、ドライバー（または受信割り込み）の時刻で記録されます。
+     *
+     * @param frame 送受信したフレーム
+     * @param direction フレームの方向
+     */
+    void notify_taps(const Frame& frame, TapDirection direction)
+    {
+        if (taps_.empty()) {
+            return;
+        }
+        TimestampUs timestamp_us = frame.timestamp();
+        if (timestamp_us == 0) {
+            timestamp_us = now_us();
+        }
+        taps_.notify(frame, direction, timestamp_us);
+    }
+
+    Driver& driver_;                                        // ドライバーの参照を保持
+    detail::DeviceSlots<Device, Capacity> devices_;         // 登録されているデバイス
+    detail::RoutingTable<Device, Capacity> routing_table_;  // ルーティングIDから配送先を引くテーブル
+    std::array<Frame, RxBatchSize> rx_buffer_{};            // receive_batch() で読み込んだ受信フレーム
+    std::size_t rx_head_           = 0;                     // 次に配送する rx_buffer_ の位置
+    std::size_t rx_count_          = 0;                     // rx_buffer_ の有効なフレーム数
+    Frame* rx_borrowed_            = nullptr;               // peek_receive() で借りた受信フレーム
+    std::size_t rx_borrowed_count_ = 0;                     // 借りたフレーム数
+    std::size_t rx_borrowed_head_  = 0;                     // 次に配送する借りたフレームの位置
+    detail::TxQueue<Frame, TxQueueDepth> tx_queue_;         // ハードウェアが満杯のときの送信キュー
+    detail::TxStagingPool<Frame> tx_staging_;               // ビルダーが直接書き込む送信フレーム
+    detail::TapList<Frame> taps_;                           // 全ての送受信フレームを受け取るタップ
+    TimeSourceUs time_source_ = nullptr;                    // 時刻の取得元
+    detail::StatsBlock<BusStats> stats_;                    // 送受信統計
+    std::array<Device*, Capacity> stats_pending_{};         // 統計の公開待ちのデバイス
+    std::size_t stats_pending_count_ = 0;                   // 公開待ちのデバイス数
+    Device* dispatch_current_        = nullptr;             // 受信処理中のデバイス（解除されたら nullptr）
+    Device* dispatch_next_           = nullptr;             // 次に配送するデバイス（解除されたら後続へ進む）
+#if defined(GN10_CAN_ENABLE_LATENCY_PROFILE)
+    CycleCounter cycle_counter_ = nullptr;  // 処理時間の計測に使うカウンタ
+    LatencyProfile latency_profile_;        // 処理時間のヒストグラム
+#endif
+};
+
+}  // namespace gn10_can
@@ -0,0 +1,439 @@
+/**
+ * @file basic_device.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フレーム型で共通化したデバイス抽象化クラスのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "gn10_can/core/bus_interface.hpp"
+#include "gn10_can/core/bus_stats.hpp"
+#include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/device_slots.hpp"
+#include "gn10_can/core/frame_builder.hpp"
+#include "gn10_can/core/routing_table.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief デバイス（MotorDriverやServoDriverなど）の抽象化クラス
+ * @note 各デバイス毎に具体化クラス (CANDevice / FDCANDevice) を継承して定義してください。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ */
+template <typename Frame>
+class BasicDevice
+{
+public:
+    static constexpr std::size_t COMMAND_COUNT = std::size_t{1} << id::BIT_WIDTH_COMMAND;
+
+    /**
+     * @brief コマンド1つ分の受信処理関数
+     *
+     * command_handler<Derived, &Derived::method> でメンバ関数から生成します。
+     */
+    using CommandHandler = void (*)(BasicDevice& device, const Frame& frame);
+
+    /**
+     * @brief コマンド (CAN IDの下位3bit) で引く受信処理関数のテーブル（未使用のコマンドは nullptr）
+     *
+     */
+    using CommandTable = std::array<CommandHandler, COMMAND_COUNT>;
+
+    /**
+     * @brief デバイス抽象化クラスのコンストラクタ
+     *
+     * @param bus CANパケットを送信する為のバスの参照
+     * @param device_type デバイスの種類
+     * @param device_id
+     * デバイスのID（同じデバイスの種類のデバイスが複数あることを配慮して、0,1,2,..）
+     *
+     * @note バスへの登録に失敗した場合（デバイス数上限など）は is_attached() が false を返します。
+     */
+    BasicDevice(IBus<Frame>& bus, id::DeviceType device_type, uint8_t device_id)
+        : bus_(bus),
+          device_type_(device_type),
+          device_id_(device_id),
+          routing_id_(
+              (static_cast<uint32_t>(device_type) << id::BIT_WIDTH_DEV_ID) |
+              static_cast<uint32_t>(device_id)
+          ),
+          base_can_id_(id::base_id(device_type, device_id))
+    {
+        attached_ = bus_.attach(this);
+    }
+
+    virtual ~BasicDevice()
+    {
+        if (attached_) {
+            bus_.detach(this);
+        }
+    }
+
+    // コピーとムーブを禁止 (RAIIによるデバイス登録の一意性を保つため)
+    BasicDevice(const BasicDevice&)            = delete;
+    BasicDevice& operator=(const BasicDevice&) = delete;
+    BasicDevice(BasicDevice&&)                 = delete;
+    BasicDevice& operator=(BasicDevice&&)      = delete;
+
+    /**
+     * @brief CANパケット受信時の呼び出し関数
+     *
+     * 既定の実装はコマンドテーブルの受信処理関数を呼び出します。
+     * コマンドテーブルを使わないデバイスはオーバーライドしてください。
+     *
+     * @param frame 受信したCANパケット
+     */
+    virtual void on_receive(const Frame& frame)
+    {
+        if (command_table_ != nullptr) {
+            call_handler(frame, static_cast<uint8_t>(frame.id & (COMMAND_COUNT - 1)));
+        }
+    }
+
+    /**
+     * @brief バスから受信フレームを渡す関数
+     *
+     * コマンドテーブルがあればコマンドで直接受信処理関数を引き、なければ on_receive() を呼びます。
+     * ID の分解はバスが1フレームにつき1度だけ行います。
+     * 受信の統計はフレームごとには公開せず、バスが update() の終わりに publish_stats() で公開します。
+     *
+     * @param frame 受信したCANパケット
+     * @param command フレームのコマンド (CAN IDの下位3bit)
+     * @return true 前回の publish_stats() 以降で最初の受信（バスが公開対象に加える）
+     * @return false 既に公開対象に含まれている
+     */
+    bool deliver(const Frame& frame, uint8_t command)
+    {
+        return deliver_as<BasicDevice>(frame, command);
+    }
+
+    /**
+     * @brief デバイスの型を指定して受信フレームを渡す関数（BasicStaticBus 内部利用）
+     *
+     * deliver() と同じ処理で、コマンドテーブルを持たない場合は Derived::on_receive() を
+     * 型を指定して（仮想関数テーブルを経由せずに）呼び出します。
+     *
+     * @tparam Derived このデバイスの実際の型
+     * @param frame 受信したCANパケット
+     * @param command フレームのコマンド (CAN IDの下位3bit)
+     * @return true 前回の publish_stats() 以降で最初の受信
+     * @return false 既に公開対象に含まれている
+     */
+    template <typename Derived>
+    bool deliver_as(const Frame& frame, uint8_t command)
+    {
+        // 受信処理でデバイスが自身を破棄しても触れないよう、統計は受信処理の前に更新する
+        stats_.work().rx_frames++;
+        bool first     = !stats_pending_;
+        stats_pending_ = true;
+        if (command_table_ != nullptr) {
+            call_handler(frame, command);
+        } else if constexpr (std::is_same_v<Derived, BasicDevice>) {
+            on_receive(frame);
+        } else {
+            static_cast<Derived&>(*this).Derived::on_receive(frame);
+        }
+        return first;
+    }
+
+    /**
+     * @brief 受信の統計を公開する（バス内部利用）
+     *
+     */
+    void publish_stats()
+    {
+        stats_pending_ = false;
+        stats_.publish();
+    }
+
+    /**
+     * @brief 公開されていない受信の統計があるか確認する（バス内部利用）
+     *
+     * @return true deliver() 後に publish_stats() されていない
+     * @return false 公開済み
+     */
+    bool has_pending_stats() const
+    {
+        return stats_pending_;
+    }
+
+    /**
+     * @brief ルーティングIDを取得
+     *
+     * コマンド部を除いた、デバイス特定用の上位ビット列を返します（生成時に計算した値）。
+     *
+     * @return uint32_t Routing ID (Type + DeviceID)
+     */
+    uint32_t get_routing_id() const
+    {
+        return routing_id_;
+    }
+
+    /**
+     * @brief バスに登録されているか確認する
+     *
+     * @return true 登録成功（受信フレームが配送される）
+     * @return false 登録失敗（デバイス数上限、またはルーティングIDが範囲外）
+     */
+    bool is_attached() const
+    {
+        return attached_;
+    }
+
+    /**
+     * @brief このデバイスの送受信統計を取得する（update() を呼ぶスレッド以外からも呼び出し可能）
+     *
+     * 受信の項目は update() の終わりに公開された値、送信の項目はその時点の値です。
+     * 公開の途中で待つことがあるため、割り込みからは try_stats() を使ってください。
+     *
+     * @return DeviceStats 統計のスナップショット
+     */
+    DeviceStats stats() const
+    {
+        DeviceStats result = stats_.snapshot();
+        load_tx_counts(result);
+        return result;
+    }
+
+    /**
+     * @brief このデバイスの送受信統計の取得を試みる（割り込みを含むどのコンテキストからも呼び出し可能）
+     *
+     * 受信統計の公開中に割り込んだ場合は待たずに失敗します。
+     *
+     * @param out 統計の格納先（失敗時は変更しない）
+     * @return true 取得成功
+     * @return false 公開と重なったため取得できなかった
+     */
+    bool try_stats(DeviceStats& out) const
+    {
+        DeviceStats result;
+        if (!stats_.try_snapshot(result)) {
+            return false;
+        }
+        load_tx_counts(result);
+        out = result;
+        return true;
+    }
+
+protected:
+    /**
+     * @brief コマンド・データ・データ長からフレームを作成しバスを使用して送信
+     *
+     * @tparam CmdEnum コマンドのEnum Class
+     * @param command
+     * コマンド（データの種類を示す、CAN通信時のデータは指令として見れるためコマンドとして見なす）
+     * @param data 送信データ
+     * @param len 送信データ長（MAX: Frame::MAX_DLC）
+     * @param mode 送信キューでの扱い方（目標値など最新値だけが意味を持つコマンドは Coalesce）
+     * @return true 送信成功（CANDriverの継承後クラスによって定義）
+     * @return false 送信失敗（CANDriverの継承後クラスによって定義）
+     */
+    template <typename CmdEnum>
+    bool send(
+        CmdEnum command,
+        const uint8_t* data = nullptr,
+        std::size_t len     = 0,
+        TxMode mode         = TxMode::Deliver
+    )
+    {
+        // バスの送信領域 (ビルダー用) は使わず、スタック上のフレームを送る。
+        // ビルダーを保持したまま、またはタップの通知中に呼ばれても送信できるようにするため
+        Frame frame;
+        frame.id = can_id(command);
+        frame.set_data(data, len);
+        return send_frame(frame, mode);
+    }
+
+    /**
+     * @brief コマンド・データ(array)からフレームを作成しバスを使用して送信
+     *
+     * @tparam CmdEnum コマンドのEnum Class
+     * @tparam N 送信データ長：1~Frame::MAX_DLC
+     * @param command
+     * コマンド（データの種類を示す、CAN通信時のデータは指令として見れるためコマンドとして見なす）
+     * @param data 送信データ（要素数1~Frame::MAX_DLCのarray配列）
+     * @param mode 送信キューでの扱い方（目標値など最新値だけが意味を持つコマンドは Coalesce）
+     * @return true 送信成功（CANDriverの継承後クラスによって定義）
+     * @return false 送信失敗（CANDriverの継承後クラスによって定義）
+     */
+    template <typename CmdEnum, std::size_t N>
+    bool send(CmdEnum command, const std::array<uint8_t, N>& data, TxMode mode = TxMode::Deliver)
+    {
+        return send(command, data.data(), static_cast<uint8_t>(data.size()), mode);
+    }
+
+    /**
+     * @brief 作成済みのフレームをバスを使用して送信し、統計に計上する
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
+     */
+    bool send_frame(const Frame& frame, TxMode mode = TxMode::Deliver)
+    {
+        bool sent = bus_.send_frame(frame, mode);
+        count_tx(sent);
+        return sent;
+    }
+
+    /**
+     * @brief このデバイスの CAN ID でバスの送信領域に直接書き込むビルダーを作成する
+     *
+     * データを write() で書き込み、send_frame(builder, mode) で送信します。
+     *
+     * @tparam CmdEnum コマンドのEnum Class
+     * @param command コマンド
+     * @return BasicFrameBuilder<Frame> 送信領域を確保したビルダー
+     */
+    template <typename CmdEnum>
+    BasicFrameBuilder<Frame> begin_frame(CmdEnum command)
+    {
+        return BasicFrameBuilder<Frame>(bus_, can_id(command));
+    }
+
+    /**
+     * @brief ビルダーで書き込んだフレームを送信し、統計に計上する
+     *
+     * @param builder 書き込みを終えたビルダー
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗（送信領域の確保失敗・データ長超過を含む）
+     */
+    bool send_frame(BasicFrameBuilder<Frame>& builder, TxMode mode = TxMode::Deliver)
+    {
+        bool sent = builder.commit(mode);
+        count_tx(sent);
+        return sent;
+    }
+
+    /**
+     * @brief 受信フレームのデータ部を解釈できなかったことを統計に計上する（受信処理関数内で呼ぶ）
+     *
+     */
+    void count_parse_failure()
+    {
+        stats_.work().parse_failures++;
+        bus_.count_parse_failure();
+    }
+
+    /**
+     * @brief コマンドテーブルを設定する（派生クラスのコンストラクタで呼び出す）
+     *
+     * @param table コマンドテーブル（静的な寿命を持つこと）
+     */
+    void set_command_table(const CommandTable& table)
+    {
+        command_table_ = &table;
+    }
+
+    /**
+     * @brief このデバイスがコマンドを送信する CAN ID を取得する
+     *
+     * 生成時に計算したコマンド部が0の CAN ID にコマンドを OR するだけで、id::pack() と同じ値を返します。
+     * コマンドは通常定数のため、送信時の ID の計算は即値の OR 1つになります。
+     *
+     * @tparam CmdEnum コマンドのEnum Class
+     * @param command コマンド
+     * @return uint32_t CAN ID
+     */
+    template <typename CmdEnum>
+    uint32_t can_id(CmdEnum command) const
+    {
+        static_assert(std::is_enum<CmdEnum>::value, "Command must be an Enum class");
+        return base_can_id_ | static_cast<uint32_t>(command_index(command));
+    }
+
+    /**
+     * @brief コマンドの値からテーブルの添字を求める
+     *
+     * @tparam CmdEnum コマンドのEnum Class
+     * @param command コマンド
+     * @return std::size_t テーブルの添字
+     */
+    template <typename CmdEnum>
+    static constexpr std::size_t command_index(CmdEnum command)
+    {
+        return static_cast<std::size_t>(command) & (COMMAND_COUNT - 1);
+    }
+
+    /**
+     * @brief メンバ関数を呼び出す受信処理関数
+     *
+     * @tparam Derived デバイスの型
+     * @tparam Method 呼び出すメンバ関数
+     * @param device 受信したデバイス
+     * @param frame 受信したCANパケット
+     */
+    template <typename Derived, void (Derived::*Method)(const Frame&)>
+    static void command_handler(BasicDevice& device, const Frame& frame)
+    {
+        (static_cast<Derived&>(device).*Method)(frame);
+    }
+
+    IBus<Frame>& bus_;            // バスの参照
+    id::DeviceType device_type_;  // デバイスの種類
+    uint8_t device_id_;           // デバイスID
+
+private:
+    template <typename, std::size_t>
+    friend class detail::RoutingTable;
+    template <typename, std::size_t>
+    friend class detail::DeviceSlots;
+
+    /**
+     * @brief 送信結果を計数する
+     *
+     * 送信はどのスレッドからも行われる (BasicConcurrentBus) ため、受信側が書き込む SeqLock には入れず、
+     * relaxed なアトミック変数に加算する。
+     *
+     * @param sent 送信に成功したか
+     */
+    void count_tx(bool sent)
+    {
+        if (sent) {
+            tx_frames_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            tx_failures_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void load_tx_counts(DeviceStats& stats) const
+    {
+        stats.tx_frames   = tx_frames_.load(std::memory_order_relaxed);
+        stats.tx_failures = tx_failures_.load(std::memory_order_relaxed);
+    }
+
+    void call_handler(const Frame& frame, uint8_t command)
+    {
+        CommandHandler handler = (*command_table_)[command];
+        if (handler != nullptr) {
+            handler(*this, frame);
+        }
+    }
+
+    uint32_t routing_id_;                          // ルーティングID (Type + DeviceID)
+    uint32_t base_can_id_;                         // コマンド部が0の送信 CAN ID
+    BasicDevice* route_next_           = nullptr;  // 同じルーティングIDを持つ次のデバイス
+    BasicDevice* route_prev_           = nullptr;  // 前のデバイス（先頭では末尾のデバイス）
+    std::size_t bus_slot_              = 0;        // バスのデバイス配列での位置
+    const CommandTable* command_table_ = nullptr;  // コマンドごとの受信処理関数
+    detail::StatsBlock<DeviceStats> stats_;        // 受信統計（受信するコンテキストだけが書き込む）
+    std::atomic<uint32_t> tx_frames_{0};           // 送信したフレーム数
+    std::atomic<uint32_t> tx_failures_{0};         // 送信に失敗したフレーム数
+    bool stats_pending_ = false;                   // 公開されていない受信の統計がある
+    bool attached_      = false;                   // バスへの登録に成功したか
+};
+
+}  // namespace gn10_can
@@ -0,0 +1,126 @@
+/**
+ * @file bus_interface.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief デバイスから見たバスの抽象化クラスのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "gn10_can/core/tx_mode.hpp"
+
+namespace gn10_can {
+
+template <typename Frame>
+class BasicDevice;
+
+template <typename Frame>
+class BasicFrameBuilder;
+
+/**
+ * @brief 送信フレームを直接書き込む領域（BasicFrameBuilder が確保・確定する）
+ *
+ * @tparam Frame 扱うフレームの型
+ */
+template <typename Frame>
+struct TxSlot {
+    Frame* frame      = nullptr;  // 書き込み先のフレーム（確保失敗時は nullptr）
+    std::size_t token = 0;        // バスが領域を識別するための値
+};
+
+/**
+ * @brief デバイスから見たバスの抽象化クラス
+ *
+ * デバイスはドライバーの型やバスの容量を知らずに、このインターフェース越しに送信・登録を行います。
+ * 具体的なバスは `BasicBus<Frame, Driver, Capacity>` です。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ */
+template <typename Frame>
+class IBus
+{
+public:
+    virtual ~IBus() = default;
+
+    /**
+     * @brief フレーム送信関数
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方（送信待ちの同じIDのフレームを上書きしてよいか）
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    virtual bool send_frame(const Frame& frame, TxMode mode) = 0;
+
+    /**
+     * @brief フレーム送信関数（必ず届けるフレームとして送信）
+     *
+     * @param frame 送信するフレーム
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    bool send_frame(const Frame& frame)
+    {
+        return send_frame(frame, TxMode::Deliver);
+    }
+
+private:
+    friend class BasicDevice<Frame>;
+    friend class BasicFrameBuilder<Frame>;
+
+    /**
+     * @brief 送信フレームを直接書き込む領域を確保する
+     *
+     * 確保した領域は必ず commit_tx_slot() か cancel_tx_slot() で返却してください。
+     *
+     * @return TxSlot<Frame> 確保した領域（空きがない場合は frame が nullptr）
+     */
+    virtual TxSlot<Frame> acquire_tx_slot() = 0;
+
+    /**
+     * @brief 書き込みを終えた領域のフレームを送信する
+     *
+     * @param slot acquire_tx_slot() で確保した領域
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功（send_frame() と同じ）
+     * @return false 送信失敗
+     */
+    virtual bool commit_tx_slot(const TxSlot<Frame>& slot, TxMode mode) = 0;
+
+    /**
+     * @brief 確保した領域を送信せずに返却する
+     *
+     * @param slot acquire_tx_slot() で確保した領域
+     */
+    virtual void cancel_tx_slot(const TxSlot<Frame>& slot) = 0;
+
+    /**
+     * @brief デバイスをバスに接続する (RAII内部利用)
+     *
+     * @param device 登録するデバイスへのポインタ
+     * @return true 登録成功
+     * @return false 登録失敗（デバイス数上限）
+     */
+    virtual bool attach(BasicDevice<Frame>* device) = 0;
+
+    /**
+     * @brief デバイスをバスから切断する (RAII内部利用)
+     *
+     * @param device 登録解除するデバイスへのポインタ
+     */
+    virtual void detach(BasicDevice<Frame>* device) = 0;
+
+    /**
+     * @brief デバイスがデータ部を解釈できなかったことを統計に計上する
+     *
+     * 既定の実装は何もしません（統計を持たないバス向け）。
+     */
+    virtual void count_parse_failure() {}
+};
+
+}  // namespace gn10_can
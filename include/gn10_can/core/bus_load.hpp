@@ -0,0 +1,333 @@
+/**
+ * @file bus_load.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 送受信フレームからバスの使用率を推定するタップ
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
+#include "gn10_can/core/frame_cost.hpp"
+#include "gn10_can/core/timestamp.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief バス使用率の推定の設定
+ *
+ */
+struct BusLoadConfig {
+    // 調停ビットレート[bit/s]
+    uint32_t nominal_bitrate = 1000000;
+    // CAN FD のデータビットレート[bit/s]（bit_rate_switch が真のフレームに使う、0 は BRS なし）
+    uint32_t data_bitrate = 0;
+    // 1区間の長さ[us]（窓の長さは 区間 × WindowSlots）
+    TimestampUs slot_us = 10000;
+    // スタッフビットの数え方（WorstCase は O(1) で最悪値）
+    frame_cost::Stuffing stuffing = frame_cost::Stuffing::Actual;
+};
+
+/**
+ * @brief 送受信フレームの占有時間を積算し、直近の窓でのバス使用率を求めるタップ
+ *
+ * `BasicBus::add_tap()` で登録し、バスに時刻の取得元 (`set_time_source()`) を設定してください。
+ * 各フレームのビット数をスタッフビット込みで計算し (frame_cost)、窓を WindowSlots 個の区間に分けて
+ * 積算します（区間が進むと最も古い区間を捨てる、スライディングウィンドウ）。
+ * ルーティングIDごとの使用率も、最初に現れた MaxRoutes 個まで記録します。
+ *
+ * 1フレームあたりの処理はビット列を1度なぞるだけ（約100bit）で、動的メモリは使用しません。
+ * STM32 でさらに軽くする場合は `frame_cost::Stuffing::WorstCase`（O(1)、最悪値で見積もる）を使います。
+ *
+ * @code
+ * gn10_can::BusLoadConfig config;
+ * config.nominal_bitrate = 1000000;
+ * gn10_can::CANBusLoadEstimator<> load(config);
+ * bus.add_tap(load);
+ *
+ * float usage = load.utilization(bus.now_us());  // 0.0 〜 1.0
+ * @endcode
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam MaxRoutes 使用率を個別に記録するルーティングIDの数
+ * @tparam WindowSlots 窓を分割する区間の数
+ */
+template <typename Frame, std::size_t MaxRoutes = 16, std::size_t WindowSlots = 10>
+class BasicBusLoadEstimator : public BasicTap<Frame>
+{
+    static_assert(WindowSlots > 0, "WindowSlots must be at least 1");
+
+public:
+    static constexpr std::size_t MAX_ROUTES   = MaxRoutes;
+    static constexpr std::size_t WINDOW_SLOTS = WindowSlots;
+
+    /**
+     * @brief コンストラクタ
+     *
+     * @param config ビットレート・区間の長さ・スタッフビットの数え方
+     */
+    explicit BasicBusLoadEstimator(const BusLoadConfig& config) : config_(config)
+    {
+        if (config_.slot_us == 0) {
+            config_.slot_us = 1;
+        }
+        if (config_.nominal_bitrate > 0) {
+            nominal_bit_ps_ = 1000000000000ull / config_.nominal_bitrate;
+        }
+        data_bit_ps_ = nominal_bit_ps_;
+        if (config_.data_bitrate > 0) {
+            data_bit_ps_ = 1000000000000ull / config_.data_bitrate;
+        }
+    }
+
+    /**
+     * @brief 直近の窓でのバス全体の使用率を取得する
+     *
+     * @param now_us 現在時刻[us]（バスの now_us()）
+     * @return float 使用率 (0.0 〜 1.0、フレームの時刻がずれると僅かに1を超えることがある)
+     */
+    float utilization(TimestampUs now_us) const
+    {
+        return ratio(window_sum(total_ns_, now_us), now_us);
+    }
+
+    /**
+     * @brief 直近の窓での、ルーティングIDのフレームによる使用率を取得する
+     *
+     * @param routing_id ルーティングID (Frame::get_routing_id())
+     * @param now_us 現在時刻[us]
+     * @return float 使用率（記録していないルーティングIDは0）
+     */
+    float utilization(uint32_t routing_id, TimestampUs now_us) const
+    {
+        for (std::size_t i = 0; i < route_count_; ++i) {
+            if (route_ids_[i] == routing_id) {
+                return ratio(window_sum(route_ns_[i], now_us), now_us);
+            }
+        }
+        return 0.0f;
+    }
+
+    /**
+     * @brief 直近の窓で、最も使用率が高かった区間の使用率を取得する（瞬間的な混雑の目安）
+     *
+     * @param now_us 現在時刻[us]
+     * @return float 区間ごとの使用率の最大値
+     */
+    float peak_slot_utilization(TimestampUs now_us) const
+    {
+        uint32_t peak_ns = 0;
+        for (std::size_t i = 0; i < WindowSlots; ++i) {
+            if (slot_in_window(i, now_us) && total_ns_[i] > peak_ns) {
+                peak_ns = total_ns_[i];
+            }
+        }
+        return static_cast<float>(peak_ns) / (static_cast<float>(config_.slot_us) * 1000.0f);
+    }
+
+    /**
+     * @brief 使用率を個別に記録しているルーティングIDの数を取得する
+     *
+     * @return std::size_t ルーティングIDの数
+     */
+    std::size_t route_count() const
+    {
+        return route_count_;
+    }
+
+    /**
+     * @brief 記録しているルーティングIDを取得する（現れた順）
+     *
+     * @param index 0 〜 route_count() - 1
+     * @return uint32_t ルーティングID
+     */
+    uint32_t route_id(std::size_t index) const
+    {
+        return route_ids_[index];
+    }
+
+    /**
+     * @brief MaxRoutes を超えたため個別に記録できなかったフレーム数を取得する
+     *
+     * @return uint32_t フレーム数（バス全体の使用率には含まれる）
+     */
+    uint32_t untracked_frames() const
+    {
+        return untracked_frames_;
+    }
+
+    void on_frame(const Frame& frame, TapDirection, TimestampUs timestamp_us) override
+    {
+        frame_cost::BitCount bits =
+            frame_cost::frame_bits(frame, config_.data_bitrate > 0, config_.stuffing);
+        uint64_t cost_ps = static_cast<uint64_t>(bits.nominal_bits) * nominal_bit_ps_ +
+                           static_cast<uint64_t>(bits.data_bits) * data_bit_ps_;
+        uint32_t cost_ns = static_cast<uint32_t>(cost_ps / 1000u);
+
+        std::size_t slot = advance(timestamp_us);
+        total_ns_[slot] += cost_ns;
+
+        std::size_t route = find_or_add_route(frame.get_routing_id());
+        if (route < MaxRoutes) {
+            route_ns_[route][slot] += cost_ns;
+        } else {
+            untracked_frames_++;
+        }
+    }
+
+private:
+    using Slots = std::array<uint32_t, WindowSlots>;
+
+    /**
+     * @brief 時刻が属する区間へ進め、通り過ぎた区間を0にする
+     *
+     * @param now_us 現在時刻[us]
+     * @return std::size_t 時刻が属する区間
+     */
+    std::size_t advance(TimestampUs now_us)
+    {
+        uint32_t slot_number = now_us / config_.slot_us;
+        if (!started_) {
+            started_      = true;
+            slot_number_  = slot_number;
+            window_start_ = slot_number;
+        }
+        uint32_t elapsed = slot_number - slot_number_;
+        if (elapsed > 0x80000000u) {
+            elapsed = 0;  // 時刻が戻った場合（受信時刻のずれなど）は現在の区間に積む
+        }
+        if (elapsed > WindowSlots) {
+            elapsed = WindowSlots;
+        }
+        for (uint32_t i = 1; i <= elapsed; ++i) {
+            std::size_t slot = (slot_number_ + i) % WindowSlots;
+            total_ns_[slot]  = 0;
+            for (std::size_t route = 0; route < route_count_; ++route) {
+                route_ns_[route][slot] = 0;
+            }
+        }
+        if (static_cast<int32_t>(slot_number - slot_number_) > 0) {
+            slot_number_ = slot_number;
+        }
+        return slot_number_ % WindowSlots;
+    }
+
+    /**
+     * @brief 区間が現在時刻の窓に含まれるか確認する
+     *
+     * @param slot 区間
+     * @param now_us 現在時刻[us]
+     * @return true 窓に含まれる
+     * @return false 窓より古い、または未使用
+     */
+    bool slot_in_window(std::size_t slot, TimestampUs now_us) const
+    {
+        if (!started_) {
+            return false;
+        }
+        uint32_t now_slot = now_us / config_.slot_us;
+        uint32_t age      = now_slot - slot_number_;  // 最後に積んだ区間からの経過区間数
+        if (age > 0x80000000u) {
+            age = 0;
+        }
+        // slot_number_ から数えて何区間前に積んだ区間か
+        std::size_t back = (slot_number_ % WindowSlots + WindowSlots - slot) % WindowSlots;
+        return back + age < WindowSlots;
+    }
+
+    /**
+     * @brief 窓に含まれる区間の合計を求める
+     *
+     * @param slots 区間ごとの占有時間[ns]
+     * @param now_us 現在時刻[us]
+     * @return uint64_t 占有時間の合計[ns]
+     */
+    uint64_t window_sum(const Slots& slots, TimestampUs now_us) const
+    {
+        uint64_t sum = 0;
+        for (std::size_t i = 0; i < WindowSlots; ++i) {
+            if (slot_in_window(i, now_us)) {
+                sum += slots[i];
+            }
+        }
+        return sum;
+    }
+
+    /**
+     * @brief 占有時間を窓の長さで割って使用率にする
+     *
+     * 窓の先頭は現在の区間の途中までなので、窓の長さは 完了した区間 + 現在の区間の経過時間 です。
+     * 計測開始から窓の長さに満たない間は、開始からの時間で割ります。
+     *
+     * @param busy_ns 占有時間[ns]
+     * @param now_us 現在時刻[us]
+     * @return float 使用率
+     */
+    float ratio(uint64_t busy_ns, TimestampUs now_us) const
+    {
+        if (!started_) {
+            return 0.0f;
+        }
+        uint32_t now_slot  = now_us / config_.slot_us;
+        uint32_t completed = now_slot - window_start_;
+        if (completed > WindowSlots - 1) {
+            completed = WindowSlots - 1;
+        }
+        uint64_t window_us = static_cast<uint64_t>(completed) * config_.slot_us +
+                             now_us % config_.slot_us;
+        if (window_us == 0) {
+            return 0.0f;
+        }
+        return static_cast<float>(busy_ns) / (static_cast<float>(window_us) * 1000.0f);
+    }
+
+    /**
+     * @brief ルーティングIDの記録先を探し、なければ追加する
+     *
+     * @param routing_id ルーティングID
+     * @return std::size_t 記録先（満杯の場合は MaxRoutes）
+     */
+    std::size_t find_or_add_route(uint32_t routing_id)
+    {
+        for (std::size_t i = 0; i < route_count_; ++i) {
+            if (route_ids_[i] == routing_id) {
+                return i;
+            }
+        }
+        if (route_count_ >= MaxRoutes) {
+            return MaxRoutes;
+        }
+        route_ids_[route_count_] = routing_id;
+        route_ns_[route_count_].fill(0);
+        return route_count_++;
+    }
+
+    BusLoadConfig config_;                         // 設定
+    uint64_t nominal_bit_ps_ = 0;                  // 調停ビットレートの1bitの時間[ps]
+    uint64_t data_bit_ps_    = 0;                  // データビットレートの1bitの時間[ps]
+    Slots total_ns_{};                             // 区間ごとのバス全体の占有時間[ns]
+    std::array<Slots, MaxRoutes> route_ns_{};      // ルーティングID・区間ごとの占有時間[ns]
+    std::array<uint32_t, MaxRoutes> route_ids_{};  // 記録しているルーティングID
+    std::size_t route_count_   = 0;                // 記録しているルーティングIDの数
+    uint32_t untracked_frames_ = 0;                // 個別に記録できなかったフレーム数
+    uint32_t slot_number_      = 0;                // 最後に積んだ区間の通し番号
+    uint32_t window_start_     = 0;                // 最初に積んだ区間の通し番号
+    bool started_              = false;            // 1フレーム以上積んだか
+};
+
+template <std::size_t MaxRoutes = 16, std::size_t WindowSlots = 10>
+using CANBusLoadEstimator = BasicBusLoadEstimator<CANFrame, MaxRoutes, WindowSlots>;
+
+template <std::size_t MaxRoutes = 16, std::size_t WindowSlots = 10>
+using FDCANBusLoadEstimator = BasicBusLoadEstimator<FDCANFrame, MaxRoutes, WindowSlots>;
+
+}  // namespace gn10_can
@@ -0,0 +1,106 @@
+/**
+ * @file bus_stats.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief バス・デバイスの送受信統計のヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_can/utils/seqlock.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief バス全体の送受信統計（累計、約43億で一周する）
+ *
+ */
+struct BusStats {
+    uint32_t rx_frames             = 0;  // ドライバーから受信したフレーム数
+    uint32_t tx_frames             = 0;  // ドライバーに送信を受け付けられたフレーム数
+    uint32_t tx_failures           = 0;  // send_frame() が失敗したフレーム数（キューなし・満杯）
+    uint32_t unrouted_frames       = 0;  // どのデバイスにも配送されなかった受信フレーム数
+    uint32_t parse_failures        = 0;  // デバイスがデータ部を解釈できなかった受信フレーム数
+    uint32_t max_frames_per_update = 0;  // 1回の update() で配送したフレーム数の最大値
+};
+
+/**
+ * @brief デバイス（ルーティングID）ごとの送受信統計（累計）
+ *
+ */
+struct DeviceStats {
+    uint32_t rx_frames      = 0;  // 配送された受信フレーム数
+    uint32_t tx_frames      = 0;  // 送信した（送信キューへの投入を含む）フレーム数
+    uint32_t tx_failures    = 0;  // 送信に失敗したフレーム数
+    uint32_t parse_failures = 0;  // データ部を解釈できなかった受信フレーム数
+};
+
+namespace detail {
+
+/**
+ * @brief 統計の作業用コピーと、他のスレッドから読み出すための公開用スナップショット
+ *
+ * 計数は送受信を行う1つのコンテキストだけが作業用コピーに対して行い (通常の加算のみ)、
+ * publish() で公開用の utils::SeqLock へまとめて書き込みます（SeqLock の書き込み側はこの1つだけ）。
+ * 他のスレッドからは snapshot() で途中の状態を見ずに読み出せます。計数するコンテキストを
+ * 中断して実行される割り込みからは、待たずに失敗する try_snapshot() を使います。
+ *
+ * @tparam Stats 統計の構造体
+ */
+template <typename Stats>
+class StatsBlock
+{
+public:
+    /**
+     * @brief 作業用コピーを取得する（計数するコンテキスト専用）
+     *
+     * @return Stats& 作業用コピー
+     */
+    Stats& work()
+    {
+        return work_;
+    }
+
+    /**
+     * @brief 作業用コピーを公開する（計数するコンテキスト専用）
+     *
+     */
+    void publish()
+    {
+        published_.store(work_);
+    }
+
+    /**
+     * @brief 最後に公開された統計を取得する（計数するコンテキスト以外のスレッドから呼び出し可能）
+     *
+     * @return Stats 統計のスナップショット
+     */
+    Stats snapshot() const
+    {
+        return published_.load();
+    }
+
+    /**
+     * @brief 最後に公開された統計の取得を試みる（割り込みを含むどのコンテキストからも呼び出し可能）
+     *
+     * @param out 統計の格納先（失敗時は変更しない）
+     * @return true 取得成功
+     * @return false 公開中の割り込みから呼ばれたなど、公開と重なったため取得できなかった
+     */
+    bool try_snapshot(Stats& out) const
+    {
+        return published_.try_load(out);
+    }
+
+private:
+    Stats work_{};                      // 計数用
+    utils::SeqLock<Stats> published_;  // 読み出し用
+};
+
+}  // namespace detail
+}  // namespace gn10_can
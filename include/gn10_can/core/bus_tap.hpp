@@ -0,0 +1,200 @@
+/**
+ * @file bus_tap.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief バスを流れる全ての送受信フレームを監視するタップのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_can/core/timestamp.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief タップに通知されたフレームの方向
+ *
+ */
+enum class TapDirection : uint8_t {
+    Rx,  // ドライバーから受信したフレーム（配送先の有無によらない）
+    Tx,  // ドライバーに送信を受け付けられたフレーム
+};
+
+namespace detail {
+template <typename Frame>
+class TapList;
+}  // namespace detail
+
+/**
+ * @brief バスを流れる全ての送受信フレームを受け取るタップ（ロガー・統計・ゲートウェイ向け）
+ *
+ * デバイスと異なりルーティングIDによらず全てのフレームを受け取ります。
+ * `BasicBus::add_tap()` で登録し、破棄時には自動的に登録解除されます。
+ * on_frame() は update() / send_frame() / flush() を呼んだコンテキストで呼ばれるため、
+ * 処理は短く保ってください。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ */
+template <typename Frame>
+class BasicTap
+{
+public:
+    BasicTap() = default;
+    virtual ~BasicTap();
+
+    // コピーとムーブを禁止 (バスがタップのアドレスを保持するため)
+    BasicTap(const BasicTap&)            = delete;
+    BasicTap& operator=(const BasicTap&) = delete;
+    BasicTap(BasicTap&&)                 = delete;
+    BasicTap& operator=(BasicTap&&)      = delete;
+
+    /**
+     * @brief フレームの送受信時に呼ばれる関数
+     *
+     * @param frame 送受信したフレーム
+     * @param direction フレームの方向
+     * @param timestamp_us フレームの受信時刻[us]。未設定のフレームはバスの時刻（取得元が未設定の場合は0）
+     */
+    virtual void on_frame(const Frame& frame, TapDirection direction, TimestampUs timestamp_us) = 0;
+
+    /**
+     * @brief バスに登録されているか確認する
+     *
+     * @return true 登録されている
+     * @return false 登録されていない
+     */
+    bool is_attached() const
+    {
+        return list_ != nullptr;
+    }
+
+private:
+    friend class detail::TapList<Frame>;
+
+    detail::TapList<Frame>* list_ = nullptr;  // 登録先のタップリスト
+    BasicTap* tap_next_           = nullptr;  // 同じバスに登録された次のタップ
+};
+
+namespace detail {
+
+/**
+ * @brief バスに登録されたタップの単方向リスト(侵入型)
+ *
+ * リンクはタップ側に保持するため、登録数によらず動的メモリは使用しません。
+ * タップが1つもなければ notify() の呼び出し側は先頭ポインタの確認だけで済みます。
+ *
+ * @tparam Frame 扱うフレームの型
+ */
+template <typename Frame>
+class TapList
+{
+public:
+    using Tap = BasicTap<Frame>;
+
+    TapList() = default;
+
+    ~TapList()
+    {
+        // バスが先に破棄された場合、タップが破棄済みのリストを参照しないようにする
+        Tap* tap = head_;
+        while (tap != nullptr) {
+            Tap* next      = tap->tap_next_;
+            tap->list_     = nullptr;
+            tap->tap_next_ = nullptr;
+            tap            = next;
+        }
+    }
+
+    TapList(const TapList&)            = delete;
+    TapList& operator=(const TapList&) = delete;
+
+    /**
+     * @brief タップを末尾に登録する（登録順に通知）
+     *
+     * @param tap 登録するタップ
+     * @return true 登録成功
+     * @return false 登録失敗（既にいずれかのバスに登録済み）
+     */
+    bool add(Tap& tap)
+    {
+        if (tap.list_ != nullptr) {
+            return false;
+        }
+        Tap** link = &head_;
+        while (*link != nullptr) {
+            link = &(*link)->tap_next_;
+        }
+        *link         = &tap;
+        tap.list_     = this;
+        tap.tap_next_ = nullptr;
+        return true;
+    }
+
+    /**
+     * @brief タップの登録を解除する
+     *
+     * @param tap 登録解除するタップ（このリストに登録されていない場合は何もしない）
+     */
+    void remove(Tap& tap)
+    {
+        if (tap.list_ != this) {
+            return;
+        }
+        for (Tap** link = &head_; *link != nullptr; link = &(*link)->tap_next_) {
+            if (*link == &tap) {
+                *link         = tap.tap_next_;
+                tap.list_     = nullptr;
+                tap.tap_next_ = nullptr;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief タップが1つも登録されていないか確認する
+     *
+     * @return true 登録なし
+     * @return false 登録あり
+     */
+    bool empty() const
+    {
+        return head_ == nullptr;
+    }
+
+    /**
+     * @brief 全てのタップにフレームを通知する
+     *
+     * @param frame 送受信したフレーム
+     * @param direction フレームの方向
+     * @param timestamp_us 時刻[us]
+     */
+    void notify(const Frame& frame, TapDirection direction, TimestampUs timestamp_us) const
+    {
+        Tap* tap = head_;
+        while (tap != nullptr) {
+            Tap* next = tap->tap_next_;  // on_frame() 内での登録解除に備える
+            tap->on_frame(frame, direction, timestamp_us);
+            tap = next;
+        }
+    }
+
+private:
+    Tap* head_ = nullptr;  // 最初に登録されたタップ
+};
+
+}  // namespace detail
+
+template <typename Frame>
+BasicTap<Frame>::~BasicTap()
+{
+    if (list_ != nullptr) {
+        list_->remove(*this);
+    }
+}
+
+}  // namespace gn10_can
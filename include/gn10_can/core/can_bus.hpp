@@ -11,80 +11,49 @@
  */
 #pragma once
 
-#include <array>
-#include <cstddef>
-
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/concurrent_bus.hpp"
+#include "gn10_can/core/static_bus.hpp"
+#include "gn10_can/core/can_frame.hpp"
 #include "gn10_can/drivers/can_driver_interface.hpp"
 
 namespace gn10_can {
 
-class CANDevice;
+/**
+ * @brief デバイスから見たCANバスのインターフェース
+ *
+ */
+using ICANBus = IBus<CANFrame>;
 
 /**
  * @brief
  * 物理的なCANバスをソフトウェア上で表現したクラス。デバイスの接続(Attach)と、メッセージのルーティング(Dispatch)を担当します。
  *
+ * ドライバーを静的に解決したい場合は `BasicBus<CANFrame, DriverSTM32CAN>` のように
+ * 具体的なドライバー型を指定してください。
  */
-class CANBus
-{
-public:
-    static constexpr std::size_t MAX_DEVICES = 16;  // 最大登録デバイス数
+using CANBus = BasicBus<CANFrame, drivers::ICANDriver>;
 
-    /**
-     * @brief CANBusクラスのコンストラクタ
-     *
-     * @param driver CANドライバーインターフェースの参照
-     */
-    explicit CANBus(drivers::ICANDriver& driver);
+extern template class BasicBus<CANFrame, drivers::ICANDriver>;
 
-    /**
-     * @brief CANパケットの受信とデバイスへのルーティング処理
-     *
-     * 受信データを読み込み、適切なデバイスに渡します。
-     */
-    void update();
-
-    /**
-     * @brief CANフレーム送信関数
-     *
-     * @param frame 送信するCANフレーム
-     * @return true 送信成功
-     * @return false 送信失敗
-     */
-    bool send_frame(const CANFrame& frame);
-
-private:
-    friend class CANDevice;
-
-    /**
-     * @brief デバイスをバスに接続する (RAII内部利用)
-     *
-     * CANDeviceのコンストラクタから自動的に呼び出されます。
-     *
-     * @param device 登録するデバイスへのポインタ
-     * @return true 登録成功
-     * @return false 登録失敗（デバイス数上限）
-     */
-    bool attach(CANDevice* device);
+/**
+ * @brief 複数スレッドから送信できるバス（Linux / ROS 2 ホスト向け、update() は1スレッドから呼ぶ）
+ *
+ */
+using ConcurrentCANBus = BasicConcurrentBus<CANFrame, drivers::ICANDriver>;
 
-    /**
-     * @brief デバイスをバスから切断する (RAII内部利用)
-     *
-     * CANDeviceのデストラクタから自動的に呼び出されます。
-     *
-     * @param device 登録解除するデバイスへのポインタ
-     */
-    void detach(CANDevice* device);
+/**
+ * @brief バスを流れる全ての送受信フレームを受け取るタップ
+ *
+ */
+using CANTap = BasicTap<CANFrame>;
 
-    /**
-     * @brief 受信したフレームを適切なデバイスに配送する
-     *
-     * @param frame 受信フレーム
-     */
-    void dispatch(const CANFrame& frame);
+/**
+ * @brief 接続するデバイスの型をコンパイル時に固定したバス（デバイス構成がビルド時に決まる場合）
+ *
+ * @tparam Devices 接続するデバイスの型
+ */
+template <typename... Devices>
+using StaticCANBus = BasicStaticBus<CANFrame, drivers::ICANDriver, Devices...>;
 
-    drivers::ICANDriver& driver_;                    // CANドライバーインターフェースの参照を保持
-    std::array<CANDevice*, MAX_DEVICES> devices_{};  // 登録されているデバイスの配列
-    std::size_t device_count_ = 0;                   // 登録されているデバイス数
-};
 }  // namespace gn10_can
@@ -0,0 +1,423 @@
+/**
+ * @file can_fd_gateway.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief クラシックCANバスとCAN FDバスの間でフレームを中継するゲートウェイのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/fdcan_device.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 中継する方向
+ *
+ */
+enum class GatewayDirection : uint8_t {
+    CANToFD,  // クラシックCAN → CAN FD
+    FDToCAN,  // CAN FD → クラシックCAN
+    Both,     // 双方向（Client/Server が別のバスにいる場合）
+};
+
+/**
+ * @brief ゲートウェイの統計情報
+ *
+ */
+struct GatewayStats {
+    uint32_t forwarded_to_fd  = 0;  // FD側へ中継したクラシックフレーム数
+    uint32_t forwarded_to_can = 0;  // CAN側へ中継したフレーム数
+    uint32_t packed_frames    = 0;  // 複数のクラシックフレームをまとめて送信したFDフレーム数
+    uint32_t dropped_frames   = 0;  // 送信失敗・8byte超過で中継できなかったフレーム数
+    uint32_t ignored_frames   = 0;  // パック用のルーティングIDで届いた、パック以外のフレーム数
+};
+
+/**
+ * @brief パック済みFDフレームの書式
+ *
+ * data[0] にフレーム数、以降にフレームごとに [IDの上位3bit][IDの下位8bit][DLC][データ] を
+ * 並べます。標準IDのフレームのみパックできます。末尾のパディングは無視されます。
+ */
+namespace packing {
+
+static constexpr std::size_t HEADER_SIZE = 1;  // フレーム数のバイト数
+static constexpr std::size_t RECORD_HEAD = 3;  // 1フレームあたりのID・DLCのバイト数
+
+/**
+ * @brief パック済みFDフレームにクラシックフレームを追加する
+ *
+ * @param packed 追加先のFDフレーム（空の場合は dlc = 0）
+ * @param frame 追加するクラシックフレーム（標準ID）
+ * @return true 追加した
+ * @return false 空きがない、または拡張IDのため追加できない
+ */
+inline bool append(FDCANFrame& packed, const CANFrame& frame)
+{
+    std::size_t used = packed.dlc;
+    if (used < HEADER_SIZE) {
+        used = HEADER_SIZE;
+    }
+    if (frame.is_extended || used + RECORD_HEAD + frame.dlc > FDCANFrame::MAX_DLC) {
+        return false;
+    }
+
+    packed.data[used++] = static_cast<uint8_t>((frame.id >> 8) & 0x07);
+    packed.data[used++] = static_cast<uint8_t>(frame.id & 0xFF);
+    packed.data[used++] = frame.dlc;
+    for (std::size_t i = 0; i < frame.dlc; i++) {
+        packed.data[used++] = frame.data[i];
+    }
+    packed.data[0]++;
+    packed.dlc = static_cast<uint8_t>(used);
+    return true;
+}
+
+/**
+ * @brief パック済みFDフレームからクラシックフレームを取り出す
+ *
+ * @param packed パック済みFDフレーム
+ * @param out_frames 取り出したフレームの格納先
+ * @param max_frames 格納先の要素数
+ * @return std::size_t 取り出したフレーム数（書式が壊れている場合はそこまで）
+ */
+inline std::size_t unpack(const FDCANFrame& packed, CANFrame* out_frames, std::size_t max_frames)
+{
+    if (packed.dlc < HEADER_SIZE) {
+        return 0;
+    }
+    std::size_t count  = packed.data[0];
+    std::size_t offset = HEADER_SIZE;
+    std::size_t result = 0;
+    while (result < count && result < max_frames) {
+        if (offset + RECORD_HEAD > packed.dlc) {
+            break;
+        }
+        uint8_t dlc = packed.data[offset + 2];
+        if (dlc > CANFrame::MAX_DLC || offset + RECORD_HEAD + dlc > packed.dlc) {
+            break;
+        }
+        CANFrame& frame = out_frames[result++];
+        frame.id = (static_cast<uint32_t>(packed.data[offset]) << 8) | packed.data[offset + 1];
+        frame.is_extended = false;
+        frame.set_data(&packed.data[offset + RECORD_HEAD], dlc);
+        offset += RECORD_HEAD + dlc;
+    }
+    return result;
+}
+
+}  // namespace packing
+
+/**
+ * @brief クラシックCANバスとCAN FDバスの間でフレームを中継するゲートウェイ
+ *
+ * add_route() で登録したルーティングIDごとに、各バスへ中継用の代理デバイスを接続します。
+ * 受信フレームの振り分けは各バスのルーティングテーブルがそのまま行うため、中継の追加コストは
+ * フレームの変換と送信だけです。代理デバイスはゲートウェイ内の固定長配列に生成し、
+ * 動的メモリは使用しません。
+ *
+ * enable_packing() を呼ぶと、FD側へ向かうクラシックフレームを1つのFDフレームにまとめて送り、
+ * 調停・ヘッダーのオーバーヘッドを削減します。同じIDで届いたパック済みフレームは
+ * 展開してCAN側へ中継します。パック途中のFDフレームは、次のフレームが入らなくなった時点と
+ * update() の呼び出し時に送信されるため、パックによる遅延は最大で update() の呼び出し周期です。
+ *
+ * @tparam MaxRoutes 登録できる最大ルート数
+ */
+template <std::size_t MaxRoutes = 16>
+class CANFDGateway
+{
+public:
+    /**
+     * @brief ゲートウェイのコンストラクタ
+     *
+     * @param can_bus クラシックCANバス
+     * @param fd_bus CAN FDバス
+     */
+    CANFDGateway(ICANBus& can_bus, IFDCANBus& fd_bus) : can_bus_(can_bus), fd_bus_(fd_bus) {}
+
+    // 代理デバイスがゲートウェイのアドレスを保持するため、コピーとムーブを禁止
+    CANFDGateway(const CANFDGateway&)            = delete;
+    CANFDGateway& operator=(const CANFDGateway&) = delete;
+    CANFDGateway(CANFDGateway&&)                 = delete;
+    CANFDGateway& operator=(CANFDGateway&&)      = delete;
+
+    /**
+     * @brief 中継するルートを登録する
+     *
+     * @param type 中継するデバイスの種類
+     * @param dev_id 中継するデバイスのID
+     * @param direction 中継する方向
+     * @return true 登録成功
+     * @return false 登録失敗（ルート数上限、またはバスに代理デバイスを登録できない）
+     */
+    bool add_route(id::DeviceType type, uint8_t dev_id, GatewayDirection direction)
+    {
+        bool to_fd  = (direction != GatewayDirection::FDToCAN);
+        bool to_can = (direction != GatewayDirection::CANToFD);
+        if ((to_fd && can_port_count_ >= MaxRoutes) || (to_can && fd_port_count_ >= MaxRoutes)) {
+            return false;
+        }
+
+        if (to_fd) {
+            std::optional<CANPort>& port = can_ports_[can_port_count_];
+            port.emplace(*this, type, dev_id);
+            if (!port->is_attached()) {
+                port.reset();
+                return false;
+            }
+            can_port_count_++;
+        }
+        if (to_can) {
+            std::optional<FDPort>& port = fd_ports_[fd_port_count_];
+            port.emplace(*this, type, dev_id);
+            if (!port->is_attached()) {
+                port.reset();
+                if (to_fd) {
+                    can_ports_[--can_port_count_].reset();
+                }
+                return false;
+            }
+            fd_port_count_++;
+        }
+        return true;
+    }
+
+    /**
+     * @brief FD側へのパック送信を有効にする
+     *
+     * パック済みフレームは指定したIDで送信されます。受信側は packing::unpack() で展開します。
+     * FD側から同じIDで届いたフレームも展開してCAN側へ中継します。
+     * 他のデバイス・ルートと重ならないルーティングIDを指定してください。
+     *
+     * @tparam CmdEnum コマンドの列挙型
+     * @param type パック済みフレームに使うデバイスの種類
+     * @param dev_id パック済みフレームに使うデバイスのID
+     * @param cmd パック済みフレームに使うコマンド
+     * @return true 有効化成功
+     * @return false 既に有効、またはFDバスに受信用の代理デバイスを登録できない
+     */
+    template <typename CmdEnum>
+    bool enable_packing(id::DeviceType type, uint8_t dev_id, CmdEnum cmd)
+    {
+        if (packed_port_.has_value()) {
+            return false;
+        }
+        packed_id_ = id::pack(type, dev_id, cmd);
+        packed_port_.emplace(*this, type, dev_id, true);
+        if (!packed_port_->is_attached()) {
+            packed_port_.reset();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief ゲートウェイの周期処理（パック途中のFDフレームを送信する）
+     *
+     * パック送信が有効な場合、CAN側の update() の後に毎周期呼び出してください。
+     * その周期に受信したクラシックフレームは、この呼び出しまでにFD側へ送信されます。
+     * パック送信が無効な場合は何もしません。
+     */
+    void update()
+    {
+        flush();
+    }
+
+    /**
+     * @brief パック途中のFDフレームを送信する
+     *
+     * 通常は update() とパックの空きがなくなった時点で自動的に呼ばれます。
+     * 周期を待たずに送信したい場合に呼び出してください。
+     *
+     * @return true 送信した
+     * @return false 送信するフレームがない、または送信失敗
+     */
+    bool flush()
+    {
+        if (packed_frame_.dlc == 0) {
+            return false;
+        }
+        // DLC で表せる長さに切り上げる（詰め物は0、unpack() は件数までしか読まない）
+        packed_frame_.dlc = static_cast<uint8_t>(FDCANFrame::padded_length(packed_frame_.dlc));
+        packed_frame_.id  = packed_id_;
+        bool sent         = fd_bus_.send_frame(packed_frame_);
+        if (sent) {
+            stats_.forwarded_to_fd += packed_frame_.data[0];
+            stats_.packed_frames++;
+        } else {
+            stats_.dropped_frames += packed_frame_.data[0];
+        }
+        packed_frame_ = FDCANFrame{};
+        return sent;
+    }
+
+    /**
+     * @brief 統計情報を取得する
+     *
+     * @return GatewayStats 統計情報
+     */
+    GatewayStats stats() const
+    {
+        return stats_;
+    }
+
+private:
+    /**
+     * @brief クラシックCANバスに接続する代理デバイス（CAN → FD）
+     *
+     */
+    class CANPort : public CANDevice
+    {
+    public:
+        CANPort(CANFDGateway& gateway, id::DeviceType type, uint8_t dev_id)
+            : CANDevice(gateway.can_bus_, type, dev_id), gateway_(gateway)
+        {
+        }
+
+        void on_receive(const CANFrame& frame) override
+        {
+            gateway_.forward_to_fd(frame);
+        }
+
+    private:
+        CANFDGateway& gateway_;  // 中継先を持つゲートウェイ
+    };
+
+    /**
+     * @brief CAN FDバスに接続する代理デバイス（FD → CAN）
+     *
+     */
+    class FDPort : public FDCANDevice
+    {
+    public:
+        FDPort(CANFDGateway& gateway, id::DeviceType type, uint8_t dev_id, bool packed = false)
+            : FDCANDevice(gateway.fd_bus_, type, dev_id), gateway_(gateway), packed_(packed)
+        {
+        }
+
+        void on_receive(const FDCANFrame& frame) override
+        {
+            if (packed_) {
+                gateway_.unpack_to_can(frame);
+            } else {
+                gateway_.forward_to_can(frame);
+            }
+        }
+
+    private:
+        CANFDGateway& gateway_;  // 中継先を持つゲートウェイ
+        bool packed_;            // パック済みフレームの受信用か
+    };
+
+    /**
+     * @brief クラシックフレームをFD側へ中継する
+     *
+     * @param frame 受信したクラシックフレーム
+     */
+    void forward_to_fd(const CANFrame& frame)
+    {
+        if (packed_port_.has_value() && !frame.is_extended) {
+            if (!packing::append(packed_frame_, frame)) {
+                flush();
+                packing::append(packed_frame_, frame);
+            }
+            // データ長0のフレームも入らなくなったら、周期を待たずに送信する
+            if (packed_frame_.dlc + packing::RECORD_HEAD > FDCANFrame::MAX_DLC) {
+                flush();
+            }
+            return;
+        }
+
+        FDCANFrame fd_frame;
+        fd_frame.id          = frame.id;
+        fd_frame.is_extended = frame.is_extended;
+        fd_frame.set_data(frame.data.data(), frame.dlc);
+        if (fd_bus_.send_frame(fd_frame)) {
+            stats_.forwarded_to_fd++;
+        } else {
+            stats_.dropped_frames++;
+        }
+    }
+
+    /**
+     * @brief パック済みFDフレームを展開してCAN側へ中継する
+     *
+     * パック用のルーティングIDで届いた他のコマンド・拡張IDのフレームは中継せず、
+     * ignored_frames に数えます。
+     *
+     * @param frame 受信したFDフレーム
+     */
+    void unpack_to_can(const FDCANFrame& frame)
+    {
+        if (frame.id != packed_id_ || frame.is_extended) {
+            stats_.ignored_frames++;
+            return;
+        }
+        std::array<CANFrame, MAX_PACKED_FRAMES> frames{};
+        std::size_t count = packing::unpack(frame, frames.data(), frames.size());
+        for (std::size_t i = 0; i < count; i++) {
+            send_to_can(frames[i]);
+        }
+    }
+
+    /**
+     * @brief FDフレームをCAN側へ中継する
+     *
+     * @param frame 受信したFDフレーム
+     */
+    void forward_to_can(const FDCANFrame& frame)
+    {
+        if (frame.dlc > CANFrame::MAX_DLC) {
+            stats_.dropped_frames++;
+            return;
+        }
+        CANFrame can_frame;
+        can_frame.id          = frame.id;
+        can_frame.is_extended = frame.is_extended;
+        can_frame.set_data(frame.data.data(), frame.dlc);
+        send_to_can(can_frame);
+    }
+
+    /**
+     * @brief CAN側へ送信し、統計に反映する
+     *
+     * @param frame 送信するクラシックフレーム
+     */
+    void send_to_can(const CANFrame& frame)
+    {
+        if (can_bus_.send_frame(frame)) {
+            stats_.forwarded_to_can++;
+        } else {
+            stats_.dropped_frames++;
+        }
+    }
+
+    // 1つのFDフレームにパックできるクラシックフレーム数の上限（データ長0のフレームの場合）
+    static constexpr std::size_t MAX_PACKED_FRAMES =
+        (FDCANFrame::MAX_DLC - packing::HEADER_SIZE) / packing::RECORD_HEAD;
+
+    ICANBus& can_bus_;                                         // クラシックCANバス
+    IFDCANBus& fd_bus_;                                        // CAN FDバス
+    std::array<std::optional<CANPort>, MaxRoutes> can_ports_;  // CAN側の代理デバイス
+    std::array<std::optional<FDPort>, MaxRoutes> fd_ports_;    // FD側の代理デバイス
+    std::size_t can_port_count_ = 0;                           // CAN側の代理デバイス数
+    std::size_t fd_port_count_  = 0;                           // FD側の代理デバイス数
+    std::optional<FDPort> packed_port_;                        // パック済みフレームの受信用
+    uint32_t packed_id_ = 0;                                   // パック済みフレームのCAN ID
+    FDCANFrame packed_frame_{};                                // パック途中のFDフレーム
+    GatewayStats stats_{};                                     // 統計情報
+};
+
+}  // namespace gn10_can
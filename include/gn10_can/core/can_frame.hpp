@@ -10,12 +10,13 @@
  */
 #pragma once
 
-#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 
 #include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/timestamp.hpp"
 
 namespace gn10_can {
 
@@ -24,21 +25,36 @@ namespace detail {
 /**
  * @brief CANフレーム構造体
  *
+ * `GN10_CAN_ENABLE_TIMESTAMP` を定義した場合 (CMake の ENABLE_FRAME_TIMESTAMP) のみ
+ * 受信時刻のフィールドを持ちます。未定義の場合もアクセサ (timestamp() / set_timestamp()) は使え、
+ * フレームのサイズは増えません。
  */
 template <std::size_t MaxDLC>
 struct CANFrame {
     static constexpr std::size_t MAX_DLC = MaxDLC;
+#if defined(GN10_CAN_ENABLE_TIMESTAMP)
+    static constexpr bool HAS_TIMESTAMP = true;
+#else
+    static constexpr bool HAS_TIMESTAMP = false;
+#endif
 
     uint32_t id = 0;                     // CAN ID
     std::array<uint8_t, MaxDLC> data{};  // データ配列
-    uint8_t dlc      = 0;                // データ長 (DLC)
+    uint8_t dlc      = 0;                // データ長[byte]（CAN FD は padded_length() の値）
     bool is_extended = false;
+    bool is_fd       = MaxDLC > 8;  // CAN FD フォーマットで送るか（クラシックCANは常に false）
+    bool bit_rate_switch = false;   // CAN FD のデータフェーズをデータビットレートで送るか (BRS)
+#if defined(GN10_CAN_ENABLE_TIMESTAMP)
+    TimestampUs timestamp_us = 0;  // 受信時刻[us]（ドライバーまたはバスが設定、0は未設定）
+#endif
 
     CANFrame() = default;
 
     /**
      * @brief CANフレーム作成ヘルパー関数
      *
+     * 引数が定数であればコンパイル時に作成できます（constexpr 変数として定数フレームを持てる）。
+     *
      * @tparam CmdEnum コマンドの列挙型
      * @param type デバイスの種類
      * @param dev_id デバイスのID
@@ -48,7 +64,7 @@ struct CANFrame {
      * @return CANFrame 生成したCANフレーム
      */
     template <typename CmdEnum>
-    static CANFrame make(
+    static constexpr CANFrame make(
         id::DeviceType type,
         uint8_t dev_id,
         CmdEnum cmd,
@@ -73,38 +89,163 @@ struct CANFrame {
      * @return CANFrame 生成したCANフレーム
      */
     template <typename CmdEnum>
-    static CANFrame make(
+    static constexpr CANFrame make(
         id::DeviceType type, uint8_t dev_id, CmdEnum cmd, std::initializer_list<uint8_t> payload
     )
     {
-        return make(type, dev_id, cmd, payload.begin(), payload.size());
+        // initializer_list の要素を直接 make() に渡すと、GCC は定数式の中で nullptr との比較を
+        // 評価できないため、一度配列へ移す
+        std::array<uint8_t, MaxDLC> bytes{};
+        std::size_t length = 0;
+        for (uint8_t byte : payload) {
+            if (length == MaxDLC) {
+                break;
+            }
+            bytes[length++] = byte;
+        }
+        return make(type, dev_id, cmd, bytes.data(), length);
     }
 
     /**
      * @brief CANフレームにデータを入れる関数
      *
+     * CAN FD で DLC が表せない長さ (9〜11byte など) の場合は、dlc を表せる長さに切り上げて0で埋めます。
+     *
      * @param payload 入れるデータ
      * @param length データの長さ[byte]
      */
-    void set_data(const uint8_t* payload, std::size_t length)
+    constexpr void set_data(const uint8_t* payload, std::size_t length)
     {
         // データサイズをMAX_DLC以下に制限
-        std::size_t size;
+        std::size_t size = 0;
         if (length < MAX_DLC) {
             size = length;
         } else {
             size = MAX_DLC;
         }
         // データをフレームのメンバ変数に入れる
-        if (payload != nullptr && size > 0) {
-            std::copy(payload, payload + size, data.begin());
+        // (C++17 の std::copy / std::fill は constexpr でないためループで書く、最適化で memcpy になる)
+        if (payload != nullptr) {
+            for (std::size_t i = 0; i < size; i++) {
+                data[i] = payload[i];
+            }
+        }
+        // DLC で表せる長さまで切り上げ、詰め物だけを0で埋める（それより後ろは送信されない）
+        std::size_t padded = padded_length(size);
+        for (std::size_t i = size; i < padded; i++) {
+            data[i] = 0;
+        }
+
+        dlc = static_cast<uint8_t>(padded);
+    }
+
+    /**
+     * @brief DLC で表せる、length 以上の最小のデータ長を取得する
+     *
+     * クラシックCANは 0〜8 をそのまま、CAN FD は 9byte 以上を 12, 16, 20, 24, 32, 48, 64 に切り上げます。
+     * ドライバーはこの長さのデータを送信するため、length からこの長さまでは0で埋めておきます。
+     *
+     * @param length データ長[byte]（MAX_DLC 以下）
+     * @return std::size_t 送信されるデータ長[byte]
+     */
+    static constexpr std::size_t padded_length(std::size_t length)
+    {
+        if (length <= 8 || MaxDLC <= 8) {
+            return length;
         }
-        // 書き込んだデータ以外を0で埋める
-        if (size < MAX_DLC) {
-            std::fill(data.begin() + size, data.end(), static_cast<uint8_t>(0));
+        if (length <= 24) {
+            return (length + 3) / 4 * 4;  // 12, 16, 20, 24
         }
+        if (length <= 32) {
+            return 32;
+        }
+        if (length <= 48) {
+            return 48;
+        }
+        return 64;
+    }
 
-        dlc = static_cast<uint8_t>(size);
+    /**
+     * @brief データ長を、フレームの DLC フィールドに入る4bitの値 (DLCコード) に変換する
+     *
+     * CAN FD は 9〜15 が 12, 16, 20, 24, 32, 48, 64byte を表します。DLC で表せない長さは切り上げます。
+     *
+     * @param length データ長[byte]（MAX_DLC を超える場合は MAX_DLC として扱う）
+     * @return uint8_t DLCコード (0〜15、クラシックCANは 0〜8)
+     */
+    static constexpr uint8_t to_dlc_code(std::size_t length)
+    {
+        if (length > MaxDLC) {
+            length = MaxDLC;
+        }
+        std::size_t padded = padded_length(length);
+        if (padded <= 8) {
+            return static_cast<uint8_t>(padded);
+        }
+        if (padded <= 24) {
+            return static_cast<uint8_t>(6 + padded / 4);  // 12→9, 16→10, 20→11, 24→12
+        }
+        if (padded <= 32) {
+            return 13;
+        }
+        if (padded <= 48) {
+            return 14;
+        }
+        return 15;
+    }
+
+    /**
+     * @brief DLCコードをデータ長に変換する
+     *
+     * @param code DLCコード (0〜15)
+     * @return std::size_t データ長[byte]（クラシックCANの 9〜15 は8）
+     */
+    static constexpr std::size_t from_dlc_code(uint8_t code)
+    {
+        if (code <= 8) {
+            return code;
+        }
+        if (MaxDLC <= 8) {
+            return 8;
+        }
+        if (code <= 12) {
+            return (static_cast<std::size_t>(code) - 6) * 4;
+        }
+        if (code == 13) {
+            return 32;
+        }
+        if (code == 14) {
+            return 48;
+        }
+        return 64;
+    }
+
+    /**
+     * @brief 受信時刻を取得する
+     *
+     * @return TimestampUs 受信時刻[us]（未設定、またはタイムスタンプ無効時は0）
+     */
+    constexpr TimestampUs timestamp() const
+    {
+#if defined(GN10_CAN_ENABLE_TIMESTAMP)
+        return timestamp_us;
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief 受信時刻を設定する（タイムスタンプ無効時は何もしない）
+     *
+     * @param value 受信時刻[us]
+     */
+    constexpr void set_timestamp(TimestampUs value)
+    {
+#if defined(GN10_CAN_ENABLE_TIMESTAMP)
+        timestamp_us = value;
+#else
+        (void)value;
+#endif
     }
 
     /**
@@ -115,24 +256,27 @@ struct CANFrame {
      *
      * @return uint32_t ルーティングID (DeviceType + DeviceID)
      */
-    uint32_t get_routing_id() const
+    constexpr uint32_t get_routing_id() const
     {
         // Commandビット幅分右シフトして切り捨てる
         return id >> id::BIT_WIDTH_COMMAND;
     }
 
     /**
-     * @brief CANフレーム比較演算子
+     * @brief CANフレーム比較演算子（受信時刻は比較しない）
      *
      * @param other 比較対象のCANフレーム
      * @return true 等しい
      * @return false 等しくない
      */
-    bool operator==(const CANFrame& other) const noexcept
+    constexpr bool operator==(const CANFrame& other) const noexcept
     {
         if (id != other.id || dlc != other.dlc || is_extended != other.is_extended) {
             return false;
         }
+        if (is_fd != other.is_fd || bit_rate_switch != other.bit_rate_switch) {
+            return false;
+        }
 
         for (std::size_t i = 0; i < static_cast<std::size_t>(dlc); ++i) {
             if (data[i] != other.data[i]) return false;
@@ -147,7 +291,7 @@ struct CANFrame {
      * @return true 等しくない
      * @return false 等しい
      */
-    bool operator!=(const CANFrame& other) const noexcept
+    constexpr bool operator!=(const CANFrame& other) const noexcept
     {
         return !(*this == other);
     }
@@ -123,48 +123,64 @@ struct IdFields {
     uint8_t command;
 
     template <typename CmdEnum>
-    bool is_command(CmdEnum cmd_enum) const
+    constexpr bool is_command(CmdEnum cmd_enum) const
     {
         return command == static_cast<uint8_t>(cmd_enum);
     }
 };
 
 /**
- * @brief 通信パケットの種類からCAN-IDにまとめる
+ * @brief デバイスの種類とIDから、コマンド部を0にしたCAN-IDを求める
+ *
+ * デバイスは生成時にこの値を保持し、送信時はコマンドを OR するだけで CAN-ID を作ります。
  *
- * @tparam CmdEnum コマンド
  * @param type デバイスの種類
  * @param dev_id デバイスのID
- * @param cmd コマンド
- * @return uint32_t 生成したCAN-ID
+ * @return uint32_t コマンド部が0のCAN-ID
  */
-template <typename CmdEnum>
-uint32_t pack(DeviceType type, uint8_t dev_id, CmdEnum cmd)
+constexpr uint32_t base_id(DeviceType type, uint8_t dev_id)
 {
-    static_assert(std::is_enum<CmdEnum>::value, "Command must be an Enum class");
-
     uint32_t id = 0;
 
     uint8_t val_type = static_cast<uint8_t>(type) & 0x0F;
     uint8_t val_id   = dev_id & 0x0F;
-    uint8_t val_cmd  = static_cast<uint8_t>(cmd) & 0x07;
 
     id |= (static_cast<uint32_t>(val_type) << 7);
     id |= (static_cast<uint32_t>(val_id) << 3);
-    id |= (static_cast<uint32_t>(val_cmd) << 0);
 
     return id;
 }
 
+/**
+ * @brief 通信パケットの種類からCAN-IDにまとめる
+ *
+ * 引数が定数であればコンパイル時に計算されます（constexpr 変数・static_assert でも使用可能）。
+ *
+ * @tparam CmdEnum コマンド
+ * @param type デバイスの種類
+ * @param dev_id デバイスのID
+ * @param cmd コマンド
+ * @return uint32_t 生成したCAN-ID
+ */
+template <typename CmdEnum>
+constexpr uint32_t pack(DeviceType type, uint8_t dev_id, CmdEnum cmd)
+{
+    static_assert(std::is_enum<CmdEnum>::value, "Command must be an Enum class");
+
+    uint8_t val_cmd = static_cast<uint8_t>(cmd) & 0x07;
+
+    return base_id(type, dev_id) | (static_cast<uint32_t>(val_cmd) << 0);
+}
+
 /**
  * @brief CAN-IDから通信パケットの種類を取り出す
  *
  * @param std_id CAN-ID
  * @return IdFields 通信パケットの種類が含まれる構造体
  */
-inline IdFields unpack(uint32_t std_id)
+constexpr IdFields unpack(uint32_t std_id)
 {
-    IdFields result;
+    IdFields result{};
 
     uint8_t type_val = (std_id >> 7) & 0x0F;
     result.dev_id    = (std_id >> 3) & 0x0F;
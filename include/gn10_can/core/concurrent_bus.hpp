@@ -0,0 +1,256 @@
+/**
+ * @file concurrent_bus.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 複数スレッドから送信できるバスクラス (Linux / ROS 2 ホスト向け)
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/utils/mpsc_ring_buffer.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 複数スレッドから送信できるバスクラス
+ *
+ * デバイスの送信 (`send_frame()`) はどのスレッドから呼んでも lock-free のリングバッファに積まれ、
+ * 受信スレッドが update() / flush() を呼んだときにまとめてドライバーへ送信されます。
+ * 受信・配送・ドライバーへの送信は全て受信スレッド1つで行うため、ドライバーとデバイスの受信処理は
+ * スレッドセーフである必要がありません。受信したデバイスの状態は MotorDriverClient の
+ * feedback() などのスナップショット (utils::SeqLock) で他のスレッドから読み出します。
+ *
+ * デバイスとタップの登録・解除は、受信スレッドが update() を呼んでいないときに行ってください。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam Driver `send()` / `receive()` / `receive_batch()` を持つドライバーの型
+ * @tparam Capacity 最大登録デバイス数
+ * @tparam TxRingSize スレッド間で送信フレームを受け渡すリングバッファの段数（2のべき乗）
+ * @tparam TxQueueDepth ソフトウェア送信キューの段数
+ * @tparam RxBatchSize receive_batch() で1度に読み出す最大フレーム数
+ */
+template <
+    typename Frame,
+    typename Driver,
+    std::size_t Capacity     = 16,
+    std::size_t TxRingSize   = 64,
+    std::size_t TxQueueDepth = 8,
+    std::size_t RxBatchSize  = 8>
+class BasicConcurrentBus : public BasicBus<Frame, Driver, Capacity, TxQueueDepth, RxBatchSize>
+{
+    using Base = BasicBus<Frame, Driver, Capacity, TxQueueDepth, RxBatchSize>;
+
+public:
+    using IBus<Frame>::send_frame;
+
+    static constexpr std::size_t TX_RING_SIZE = TxRingSize;  // スレッド間の送信リングバッファの段数
+
+    /**
+     * @brief 送信フレームをリングバッファに積んだときに、眠っている受信スレッドを起こす関数の型
+     *
+     */
+    using TxWakeFn = void (*)(void* context);
+
+    /**
+     * @brief バスクラスのコンストラクタ
+     *
+     * @param driver ドライバーの参照
+     */
+    explicit BasicConcurrentBus(Driver& driver) : Base(driver) {}
+
+    /**
+     * @brief 送信フレームをリングバッファに積む（どのスレッドからも呼び出し可能）
+     *
+     * ドライバーへの送信は受信スレッドの update() / flush() で行われます。
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方
+     * @return true リングバッファに積んだ
+     * @return false リングバッファが満杯のため破棄した
+     */
+    bool send_frame(const Frame& frame, TxMode mode) override
+    {
+        if (tx_ring_.try_push(PendingFrame{frame, mode})) {
+            wake_receiver();
+            return true;
+        }
+        ring_dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief リングバッファに送信フレームを積んだときに呼ぶ関数を設定する
+     *
+     * EventLoop は自身の notify() を登録し、他スレッドからの送信で起きるようにします。
+     * 起こす関数は、受信スレッドがリングバッファを読み出すまで1度だけ呼ばれます。
+     * 他のスレッドが送信していないときに設定してください。
+     *
+     * @param wake 起こす関数（nullptr で解除）
+     * @param context wake に渡す引数
+     */
+    void set_tx_wake(TxWakeFn wake, void* context)
+    {
+        tx_wake_context_ = context;
+        tx_wake_         = wake;
+    }
+
+    /**
+     * @brief リングバッファの送信フレームをドライバーへ送信し、受信・配送を行う（受信スレッド専用）
+     *
+     */
+    void update()
+    {
+        drain_tx_ring();
+        Base::update();
+    }
+
+    /**
+     * @brief 最大フレーム数を指定した update()（受信スレッド専用）
+     *
+     * @param max_frames 1回の呼び出しで配送する最大フレーム数
+     * @return UpdateResult 配送したフレーム数と未処理フレームの有無
+     */
+    UpdateResult update(std::size_t max_frames)
+    {
+        drain_tx_ring();
+        return Base::update(max_frames);
+    }
+
+    /**
+     * @brief 期限を指定した update()（受信スレッド専用）
+     *
+     * @param deadline 処理を打ち切る時刻
+     * @return UpdateResult 配送したフレーム数と未処理フレームの有無
+     */
+    template <typename Clock, typename Duration>
+    UpdateResult update_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        drain_tx_ring();
+        return Base::update_until(deadline);
+    }
+
+    /**
+     * @brief リングバッファとソフトウェア送信キューのフレームを送信する（受信スレッド専用）
+     *
+     * @return std::size_t ソフトウェア送信キューから送信したフレーム数（BasicBus::flush() と同じ）
+     */
+    std::size_t flush()
+    {
+        drain_tx_ring();
+        return Base::flush();
+    }
+
+    /**
+     * @brief リングバッファが満杯で破棄した送信フレーム数を取得する（どのスレッドからも呼び出し可能）
+     *
+     * @return uint32_t 破棄したフレーム数
+     */
+    uint32_t ring_dropped_frames() const
+    {
+        return ring_dropped_frames_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct PendingFrame {
+        Frame frame;
+        TxMode mode;
+        bool cancelled = false;  // ビルダーが送信せずに返却した（受信スレッドは読み飛ばす）
+    };
+
+    /**
+     * @brief リングバッファのセルを確保し、ビルダーがそのフレームに直接書き込めるようにする
+     *
+     * どのスレッドからも呼び出せます。確保したセルは commit / cancel まで受信スレッドの
+     * 取り出しを止めるため、ビルダーは書き込み後すぐに送信・破棄してください。
+     *
+     * @return TxSlot<Frame> 確保したセルのフレーム（リングバッファが満杯の場合は空）
+     */
+    TxSlot<Frame> acquire_tx_slot() override
+    {
+        TxSlot<Frame> slot;
+        PendingFrame* pending = tx_ring_.try_reserve(slot.token);
+        if (pending == nullptr) {
+            ring_dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+        }
+        slot.frame = &pending->frame;
+        return slot;
+    }
+
+    /**
+     * @brief 書き込みを終えたセルを受信スレッドへ渡す
+     *
+     * @param slot 書き込みを終えたセル
+     * @param mode 送信キューでの扱い方
+     * @return true 常に true（リングバッファに積んだ）
+     */
+    bool commit_tx_slot(const TxSlot<Frame>& slot, TxMode mode) override
+    {
+        PendingFrame& pending = tx_ring_.reserved(slot.token);
+        pending.mode          = mode;
+        pending.cancelled     = false;
+        tx_ring_.publish(slot.token);
+        wake_receiver();
+        return true;
+    }
+
+    /**
+     * @brief 確保したセルを送信しない印を付けて受信スレッドへ渡す
+     *
+     * @param slot 確保したセル
+     */
+    void cancel_tx_slot(const TxSlot<Frame>& slot) override
+    {
+        tx_ring_.reserved(slot.token).cancelled = true;
+        tx_ring_.publish(slot.token);
+        wake_receiver();  // このセルの後ろに公開済みのセルが待っている場合がある
+    }
+
+    /**
+     * @brief 受信スレッドがまだ起こされていなければ起こす
+     *
+     * リングバッファへの公開の後に呼びます。受信スレッドは読み出しの前に wake_pending_ を
+     * 下ろすため、読み出しに間に合わなかったフレームは次の呼び出しで必ず起こします。
+     */
+    void wake_receiver()
+    {
+        if (tx_wake_ == nullptr) {
+            return;
+        }
+        if (!wake_pending_.exchange(true, std::memory_order_acq_rel)) {
+            tx_wake_(tx_wake_context_);
+        }
+    }
+
+    /**
+     * @brief リングバッファのフレームを、通常のバスの送信経路（送信キューを含む）へ渡す
+     *
+     */
+    void drain_tx_ring()
+    {
+        wake_pending_.exchange(false, std::memory_order_acq_rel);
+        PendingFrame pending;
+        while (tx_ring_.try_pop(pending)) {
+            if (!pending.cancelled) {
+                Base::send_frame(pending.frame, pending.mode);
+            }
+        }
+    }
+
+    utils::MPSCRingBuffer<PendingFrame, TxRingSize> tx_ring_;  // 送信スレッドから受信スレッドへの受け渡し
+    std::atomic<uint32_t> ring_dropped_frames_{0};             // リングバッファ満杯で破棄した数
+    std::atomic<bool> wake_pending_{false};                    // 受信スレッドを起こし済みか
+    TxWakeFn tx_wake_      = nullptr;                          // 受信スレッドを起こす関数
+    void* tx_wake_context_ = nullptr;                          // tx_wake_ に渡す引数
+};
+
+}  // namespace gn10_can
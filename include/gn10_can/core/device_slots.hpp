@@ -0,0 +1,104 @@
+/**
+ * @file device_slots.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief バスに登録されたデバイスを O(1) で追加・削除する固定長配列
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace gn10_can {
+namespace detail {
+
+/**
+ * @brief バスに登録されたデバイスを保持する固定長配列
+ *
+ * 各デバイスは自分が格納されている位置を `bus_slot_` メンバに保持するため、
+ * 削除時に配列を探索せず O(1) で取り除けます（末尾の要素で穴埋めするため順序は変わります）。
+ *
+ * @tparam Device `std::size_t bus_slot_` を持つデバイス型
+ * @tparam Capacity 最大登録デバイス数
+ */
+template <typename Device, std::size_t Capacity>
+class DeviceSlots
+{
+public:
+    /**
+     * @brief デバイスを末尾に追加する
+     *
+     * @param device 追加するデバイス
+     * @return true 追加成功
+     * @return false 追加失敗（容量不足）
+     */
+    bool insert(Device* device)
+    {
+        if (count_ >= Capacity) {
+            return false;
+        }
+        device->bus_slot_ = count_;
+        slots_[count_++]  = device;
+        return true;
+    }
+
+    /**
+     * @brief デバイスを削除する
+     *
+     * @param device 削除するデバイス（登録されていない場合は何もしない）
+     */
+    void remove(Device* device)
+    {
+        std::size_t slot = device->bus_slot_;
+        if (slot >= count_ || slots_[slot] != device) {
+            return;
+        }
+        Device* last    = slots_[--count_];
+        slots_[slot]    = last;
+        last->bus_slot_ = slot;
+        slots_[count_]  = nullptr;
+    }
+
+    /**
+     * @brief 登録されているデバイス数を取得する
+     *
+     * @return std::size_t デバイス数
+     */
+    std::size_t size() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief 空きがないか確認する
+     *
+     * @return true 空きがない
+     * @return false 空きがある
+     */
+    bool full() const
+    {
+        return count_ >= Capacity;
+    }
+
+    /**
+     * @brief 指定した位置のデバイスを取得する
+     *
+     * @param index 位置 (size() 未満)
+     * @return Device* デバイス
+     */
+    Device* operator[](std::size_t index) const
+    {
+        return slots_[index];
+    }
+
+private:
+    std::array<Device*, Capacity> slots_{};  // 登録されているデバイス（先頭から count_ 個が有効）
+    std::size_t count_ = 0;                  // 登録されているデバイス数
+};
+
+}  // namespace detail
+}  // namespace gn10_can
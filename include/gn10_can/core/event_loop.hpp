@@ -0,0 +1,251 @@
+/**
+ * @file event_loop.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信・送信の準備ができるまで眠ってから配送するイベントループ (Linux 向け)
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#if !defined(__linux__)
+#error "event_loop.hpp requires Linux (epoll / eventfd)"
+#endif
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace gn10_can {
+
+namespace detail {
+
+/**
+ * @brief 他スレッドからの送信で起こす関数を登録できるバス (BasicConcurrentBus) か判定する
+ *
+ */
+template <typename Bus, typename = void>
+struct HasTxWake : std::false_type {};
+
+template <typename Bus>
+struct HasTxWake<Bus, std::void_t<decltype(std::declval<Bus&>().set_tx_wake(nullptr, nullptr))>>
+    : std::true_type {};
+
+}  // namespace detail
+
+/**
+ * @brief epoll でドライバーの準備完了を待ち、バスの update() を呼ぶイベントループ
+ *
+ * update() をスピンループで呼ぶ代わりに、ドライバーのファイルディスクリプタ (`event_fd()`) が
+ * 受信可能になるか、ソフトウェア送信キューにフレームが残っている間は送信可能になるまで眠ります。
+ * ファイルディスクリプタを持たないドライバー（別スレッドから受信リングへ積むものなど）の後は
+ * notify() で起こします。ConcurrentCANBus では、他スレッドからの送信で自動的に起きます。
+ *
+ * @code
+ * gn10_can::EventLoop<gn10_can::CANBus> loop(bus, driver.event_fd());
+ * while (running) {
+ *     loop.run_once(100);  // 最大100ms 眠る
+ * }
+ * @endcode
+ *
+ * @tparam Bus update() と tx_queue_stats() を持つバスの型
+ */
+template <typename Bus>
+class EventLoop
+{
+public:
+    /**
+     * @brief コンストラクタ
+     *
+     * 作成に失敗した場合は is_open() が false になります。
+     *
+     * @param bus 配送を行うバス
+     * @param driver_fd ドライバーの `event_fd()`（-1 の場合は notify() とタイムアウトのみで起きる）
+     */
+    EventLoop(Bus& bus, int driver_fd) : bus_(bus), driver_fd_(driver_fd)
+    {
+        epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+        wake_fd_  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (epoll_fd_ < 0 || wake_fd_ < 0) {
+            return;
+        }
+        if (!watch(EPOLL_CTL_ADD, wake_fd_, EPOLLIN)) {
+            return;
+        }
+        if (driver_fd_ >= 0 && !watch(EPOLL_CTL_ADD, driver_fd_, EPOLLIN)) {
+            return;
+        }
+        if constexpr (detail::HasTxWake<Bus>::value) {
+            bus_.set_tx_wake(&EventLoop::wake, this);
+        }
+        open_ = true;
+    }
+
+    /**
+     * @brief デストラクタ
+     *
+     * 他スレッドからの送信で起こす関数を登録した場合は解除するため、
+     * 送信するスレッドを止めてから破棄してください。
+     */
+    ~EventLoop()
+    {
+        if constexpr (detail::HasTxWake<Bus>::value) {
+            if (open_) {
+                bus_.set_tx_wake(nullptr, nullptr);
+            }
+        }
+        if (wake_fd_ >= 0) {
+            close(wake_fd_);
+        }
+        if (epoll_fd_ >= 0) {
+            close(epoll_fd_);
+        }
+    }
+
+    EventLoop(const EventLoop&)            = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /**
+     * @brief epoll / eventfd の作成に成功したか確認する
+     *
+     * @return true 使用可能
+     * @return false 作成失敗
+     */
+    bool is_open() const
+    {
+        return open_;
+    }
+
+    /**
+     * @brief 眠っている run_once() を起こす（どのスレッド・シグナルハンドラからも呼び出し可能）
+     *
+     */
+    void notify()
+    {
+        uint64_t one  = 1;
+        ssize_t bytes = write(wake_fd_, &one, sizeof(one));
+        (void)bytes;  // カウンタが溢れる (EAGAIN) 場合も既に起こす予定があるため無視する
+    }
+
+    /**
+     * @brief 準備ができるかタイムアウトまで眠り、バスの update() を1回呼ぶ
+     *
+     * タイムアウトした場合も update() を呼ぶため、送信キューの再送などは継続します。
+     *
+     * @param timeout_ms 最大待ち時間[ms]（-1 で無期限、0 で待たない）
+     * @return int 起床要因の数（タイムアウトは0、エラーは-1）
+     */
+    int run_once(int timeout_ms)
+    {
+        if (!open_) {
+            return -1;
+        }
+        update_tx_interest();
+
+        std::array<epoll_event, 2> events{};
+        int max_events = static_cast<int>(events.size());
+        int ready      = epoll_wait(epoll_fd_, events.data(), max_events, timeout_ms);
+        if (ready < 0) {
+            if (errno != EINTR) {
+                return -1;
+            }
+            ready = 0;
+        }
+        for (int i = 0; i < ready; ++i) {
+            if (events[i].data.fd == wake_fd_) {
+                uint64_t count = 0;
+                ssize_t bytes  = read(wake_fd_, &count, sizeof(count));
+                (void)bytes;
+            }
+        }
+
+        bus_.update();
+        return ready;
+    }
+
+    /**
+     * @brief running が false になるまで run_once() を繰り返す
+     *
+     * 他スレッドから止める場合は、running を false にした後に notify() を呼んでください。
+     *
+     * @param running 継続フラグ
+     * @param timeout_ms 1回あたりの最大待ち時間[ms]
+     */
+    void run(const std::atomic<bool>& running, int timeout_ms = -1)
+    {
+        while (running.load(std::memory_order_acquire)) {
+            if (run_once(timeout_ms) < 0) {
+                return;
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief バスから呼ばれ、notify() で眠っている run_once() を起こす
+     *
+     * @param context EventLoop のポインタ
+     */
+    static void wake(void* context)
+    {
+        static_cast<EventLoop*>(context)->notify();
+    }
+
+    /**
+     * @brief epoll の監視対象を追加・変更する
+     *
+     * @param op EPOLL_CTL_ADD / EPOLL_CTL_MOD
+     * @param fd 対象のファイルディスクリプタ
+     * @param events 待つイベント
+     * @return true 成功
+     * @return false 失敗
+     */
+    bool watch(int op, int fd, uint32_t events)
+    {
+        epoll_event event{};
+        event.events  = events;
+        event.data.fd = fd;
+        return epoll_ctl(epoll_fd_, op, fd, &event) == 0;
+    }
+
+    /**
+     * @brief 送信キューにフレームが残っている間だけ、ドライバーの送信可能も待つ
+     *
+     * 常に EPOLLOUT を待つと、送信可能な間は眠らずに戻り続けてしまうためです。
+     */
+    void update_tx_interest()
+    {
+        if (driver_fd_ < 0) {
+            return;
+        }
+        bool tx_pending = bus_.tx_queue_stats().depth > 0;
+        if (tx_pending == tx_armed_) {
+            return;
+        }
+        uint32_t events = EPOLLIN;
+        if (tx_pending) {
+            events |= EPOLLOUT;
+        }
+        if (watch(EPOLL_CTL_MOD, driver_fd_, events)) {
+            tx_armed_ = tx_pending;
+        }
+    }
+
+    Bus& bus_;               // 配送を行うバス
+    int driver_fd_;          // ドライバーの準備完了を表すディスクリプタ（-1 は未使用）
+    int epoll_fd_  = -1;     // epoll インスタンス
+    int wake_fd_   = -1;     // notify() で書き込む eventfd
+    bool open_     = false;  // 作成に成功したか
+    bool tx_armed_ = false;  // EPOLLOUT を待っているか
+};
+
+}  // namespace gn10_can
@@ -1,5 +1,5 @@
 /**
- * @file can_bus.hpp
+ * @file fdcan_bus.hpp
  * @author Gento Aiba (aiba-gento)
  * @brief
  * 物理的なFDCANバスをソフトウェア上で表現したクラス。デバイスの接続(Attach)と、メッセージのルーティング(Dispatch)を担当します。
@@ -11,80 +11,49 @@
  */
 #pragma once
 
-#include <array>
-#include <cstddef>
-
+#include "gn10_can/core/basic_bus.hpp"
+#include "gn10_can/core/concurrent_bus.hpp"
+#include "gn10_can/core/static_bus.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
 #include "gn10_can/drivers/fdcan_driver_interface.hpp"
 
 namespace gn10_can {
 
-class FDCANDevice;
+/**
+ * @brief デバイスから見たFDCANバスのインターフェース
+ *
+ */
+using IFDCANBus = IBus<FDCANFrame>;
 
 /**
  * @brief
  * 物理的なFDCANバスをソフトウェア上で表現したクラス。デバイスの接続(Attach)と、メッセージのルーティング(Dispatch)を担当します。
  *
+ * ドライバーを静的に解決したい場合は `BasicBus<FDCANFrame, DriverSTM32FDCAN>` のように
+ * 具体的なドライバー型を指定してください。
  */
-class FDCANBus
-{
-public:
-    static constexpr std::size_t MAX_DEVICES = 16;  // 最大登録デバイス数
+using FDCANBus = BasicBus<FDCANFrame, drivers::IFDCANDriver>;
 
-    /**
-     * @brief FDCANBusクラスのコンストラクタ
-     *
-     * @param driver FDCANドライバーインターフェースの参照
-     */
-    explicit FDCANBus(drivers::IFDCANDriver& driver);
+extern template class BasicBus<FDCANFrame, drivers::IFDCANDriver>;
 
-    /**
-     * @brief FDCANパケットの受信とデバイスへのルーティング処理
-     *
-     * 受信データを読み込み、適切なデバイスに渡します。
-     */
-    void update();
-
-    /**
-     * @brief FDCANフレーム送信関数
-     *
-     * @param frame 送信するCANフレーム
-     * @return true 送信成功
-     * @return false 送信失敗
-     */
-    bool send_frame(const FDCANFrame& frame);
-
-private:
-    friend class FDCANDevice;
-
-    /**
-     * @brief デバイスをバスに接続する (RAII内部利用)
-     *
-     * FDCANDeviceのコンストラクタから自動的に呼び出されます。
-     *
-     * @param device 登録するデバイスへのポインタ
-     * @return true 登録成功
-     * @return false 登録失敗（デバイス数上限）
-     */
-    bool attach(FDCANDevice* device);
+/**
+ * @brief 複数スレッドから送信できるバス（Linux / ROS 2 ホスト向け、update() は1スレッドから呼ぶ）
+ *
+ */
+using ConcurrentFDCANBus = BasicConcurrentBus<FDCANFrame, drivers::IFDCANDriver>;
 
-    /**
-     * @brief デバイスをバスから切断する (RAII内部利用)
-     *
-     * FDCANDeviceのデストラクタから自動的に呼び出されます。
-     *
-     * @param device 登録解除するデバイスへのポインタ
-     */
-    void detach(FDCANDevice* device);
+/**
+ * @brief バスを流れる全ての送受信フレームを受け取るタップ
+ *
+ */
+using FDCANTap = BasicTap<FDCANFrame>;
 
-    /**
-     * @brief 受信したフレームを適切なデバイスに配送する
-     *
-     * @param frame 受信フレーム
-     */
-    void dispatch(const FDCANFrame& frame);
+/**
+ * @brief 接続するデバイスの型をコンパイル時に固定したバス（デバイス構成がビルド時に決まる場合）
+ *
+ * @tparam Devices 接続するデバイスの型
+ */
+template <typename... Devices>
+using StaticFDCANBus = BasicStaticBus<FDCANFrame, drivers::IFDCANDriver, Devices...>;
 
-    drivers::IFDCANDriver& driver_;                    // CANドライバーインターフェースの参照を保持
-    std::array<FDCANDevice*, MAX_DEVICES> devices_{};  // 登録されているデバイスの配列
-    std::size_t device_count_ = 0;                     // 登録されているデバイス数
-};
 }  // namespace gn10_can
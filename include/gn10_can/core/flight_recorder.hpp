@@ -0,0 +1,619 @@
+/**
+ * @file flight_recorder.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 直近の送受信フレームを固定長のリングバッファに記録するフライトレコーダー
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
+#include "gn10_can/core/timestamp.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief フライトレコーダーの記録・ダンプの形式
+ *
+ * 1件の記録は次の順に並び、クラシックCANの8byteフレームで13byte程度です。
+ * | 内容 | サイズ |
+ * | :--- | :--- |
+ * | ヘッダー (方向・拡張ID・長さ) | 1byte |
+ * | 前の記録からの時刻差[us] (zigzag 符号化の可変長整数) | 1〜5byte |
+ * | CAN ID (リトルエンディアン) | 標準ID 2byte / 拡張ID 4byte |
+ * | データ長 (FLAG_LONG_LENGTH の場合のみ) | 1byte |
+ * | データ | データ長 |
+ *
+ * ダンプは DUMP_HEADER_SIZE byte のヘッダー（マジック・版・フラグ・基準時刻・件数・記録のbyte数）の後に、
+ * 古い順の記録を並べたものです。
+ */
+namespace flight_record {
+
+static constexpr uint8_t FLAG_TX          = 0x80;  // 送信フレーム（0は受信）
+static constexpr uint8_t FLAG_EXTENDED    = 0x40;  // 拡張ID
+static constexpr uint8_t FLAG_LONG_LENGTH = 0x20;  // データ長が続く1byteにある（16byte以上）
+static constexpr uint8_t LENGTH_MASK      = 0x0F;  // ヘッダーに収めたデータ長（15byte以下）
+
+static constexpr std::size_t MAX_DATA_LENGTH  = 64;  // 記録できる最大データ長
+static constexpr std::size_t MAX_VARINT_SIZE  = 5;   // 32bit の可変長整数の最大byte数
+static constexpr std::size_t MAX_ENTRY_SIZE   = 1 + MAX_VARINT_SIZE + 4 + 1 + MAX_DATA_LENGTH;
+static constexpr std::size_t DUMP_HEADER_SIZE = 20;
+
+static constexpr std::array<uint8_t, 4> MAGIC = {'G', 'N', 'F', 'R'};
+static constexpr uint8_t VERSION              = 1;
+static constexpr uint8_t DUMP_FLAG_FROZEN     = 0x01;  // トリガーで記録を止めた
+static constexpr uint8_t DUMP_FLAG_FD         = 0x02;  // CAN FD のバスで記録した
+
+/**
+ * @brief 32bit の値をリトルエンディアンで書き込む
+ *
+ * @param out 書き込み先（4byte）
+ * @param value 値
+ */
+inline void store_u32(uint8_t* out, uint32_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief リトルエンディアンの32bit の値を読み出す
+ *
+ * @param in 読み出し元（4byte）
+ * @return uint32_t 値
+ */
+inline uint32_t load_u32(const uint8_t* in)
+{
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief 符号付きの時刻差を、絶対値が小さいほど短くなる符号なし整数にする (zigzag 符号化)
+ *
+ * @param delta 時刻差
+ * @return uint32_t 符号化した値
+ */
+inline uint32_t zigzag_encode(int32_t delta)
+{
+    return (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+}
+
+/**
+ * @brief zigzag 符号化した値を元に戻す
+ *
+ * @param value 符号化した値
+ * @return int32_t 時刻差
+ */
+inline int32_t zigzag_decode(uint32_t value)
+{
+    return static_cast<int32_t>((value >> 1) ^ (0u - (value & 1u)));
+}
+
+}  // namespace flight_record
+
+/**
+ * @brief ダンプから取り出した1件の記録
+ *
+ */
+struct FlightRecordEntry {
+    TimestampUs timestamp_us = 0;                                // 送受信時刻[us]
+    TapDirection direction   = TapDirection::Rx;                 // フレームの方向
+    uint32_t id              = 0;                                // CAN ID
+    bool is_extended         = false;                            // 拡張IDか
+    uint8_t length           = 0;                                // データ長
+    std::array<uint8_t, flight_record::MAX_DATA_LENGTH> data{};  // データ
+};
+
+/**
+ * @brief BasicFlightRecorder::dump() で書き出したダンプを古い順に読み出す
+ *
+ * マイコンから吸い出したダンプを Linux のツールで読む場合など、記録したフレーム型によらず使えます。
+ *
+ * @code
+ * gn10_can::FlightRecordReader reader(buffer, size);
+ * gn10_can::FlightRecordEntry entry;
+ * while (reader.next(entry)) {
+ *     // entry.timestamp_us, entry.id, ...
+ * }
+ * @endcode
+ */
+class FlightRecordReader
+{
+public:
+    /**
+     * @brief コンストラクタ
+     *
+     * @param dump ダンプの先頭
+     * @param size ダンプのbyte数
+     */
+    FlightRecordReader(const uint8_t* dump, std::size_t size)
+    {
+        if (dump == nullptr || size < flight_record::DUMP_HEADER_SIZE) {
+            return;
+        }
+        for (std::size_t i = 0; i < flight_record::MAGIC.size(); ++i) {
+            if (dump[i] != flight_record::MAGIC[i]) {
+                return;
+            }
+        }
+        if (dump[4] != flight_record::VERSION) {
+            return;
+        }
+        uint32_t payload_size = flight_record::load_u32(dump + 16);
+        if (payload_size > size - flight_record::DUMP_HEADER_SIZE) {
+            return;
+        }
+        flags_       = dump[5];
+        time_us_     = flight_record::load_u32(dump + 8);
+        entry_count_ = flight_record::load_u32(dump + 12);
+        pos_         = dump + flight_record::DUMP_HEADER_SIZE;
+        end_         = pos_ + payload_size;
+        valid_       = true;
+    }
+
+    /**
+     * @brief ダンプのヘッダーが正しいか確認する
+     *
+     * @return true 正しい
+     * @return false マジック・版・サイズのいずれかが不正
+     */
+    bool valid() const
+    {
+        return valid_;
+    }
+
+    /**
+     * @brief 記録がトリガーで止められたか確認する
+     *
+     * @return true 止められた（最後の記録がトリガー後の最後のフレーム）
+     * @return false 記録中にダンプした
+     */
+    bool frozen() const
+    {
+        return (flags_ & flight_record::DUMP_FLAG_FROZEN) != 0;
+    }
+
+    /**
+     * @brief CAN FD のバスで記録したか確認する
+     *
+     * @return true CAN FD
+     * @return false クラシックCAN
+     */
+    bool is_fd() const
+    {
+        return (flags_ & flight_record::DUMP_FLAG_FD) != 0;
+    }
+
+    /**
+     * @brief ダンプに含まれる記録数を取得する
+     *
+     * @return uint32_t 記録数
+     */
+    uint32_t entry_count() const
+    {
+        return entry_count_;
+    }
+
+    /**
+     * @brief 次の記録を読み出す
+     *
+     * @param out_entry 読み出した記録
+     * @return true 読み出し成功
+     * @return false 終端、または記録が壊れている
+     */
+    bool next(FlightRecordEntry& out_entry)
+    {
+        if (!valid_ || read_count_ >= entry_count_ || pos_ >= end_) {
+            return false;
+        }
+        const uint8_t* pos = pos_;
+        uint8_t header     = *pos++;
+
+        uint32_t zigzag   = 0;
+        std::size_t shift = 0;
+        while (true) {
+            if (pos >= end_ || shift >= 7 * flight_record::MAX_VARINT_SIZE) {
+                return fail();
+            }
+            uint8_t byte = *pos++;
+            zigzag |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+            if ((byte & 0x80) == 0) {
+                break;
+            }
+        }
+
+        std::size_t id_size = 2;
+        if ((header & flight_record::FLAG_EXTENDED) != 0) {
+            id_size = 4;
+        }
+        if (static_cast<std::size_t>(end_ - pos) < id_size) {
+            return fail();
+        }
+        uint32_t id = 0;
+        for (std::size_t i = 0; i < id_size; ++i) {
+            id |= static_cast<uint32_t>(pos[i]) << (8 * i);
+        }
+        pos += id_size;
+
+        std::size_t length = header & flight_record::LENGTH_MASK;
+        if ((header & flight_record::FLAG_LONG_LENGTH) != 0) {
+            if (pos >= end_) {
+                return fail();
+            }
+            length = *pos++;
+        }
+        if (length > flight_record::MAX_DATA_LENGTH ||
+            static_cast<std::size_t>(end_ - pos) < length) {
+            return fail();
+        }
+
+        time_us_ += static_cast<TimestampUs>(flight_record::zigzag_decode(zigzag));
+
+        out_entry.timestamp_us = time_us_;
+        out_entry.direction    = TapDirection::Rx;
+        if ((header & flight_record::FLAG_TX) != 0) {
+            out_entry.direction = TapDirection::Tx;
+        }
+        out_entry.id          = id;
+        out_entry.is_extended = (header & flight_record::FLAG_EXTENDED) != 0;
+        out_entry.length      = static_cast<uint8_t>(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            out_entry.data[i] = pos[i];
+        }
+        pos_ = pos + length;
+        read_count_++;
+        return true;
+    }
+
+private:
+    /**
+     * @brief 壊れた記録を見つけた場合に、以降の読み出しを止める
+     *
+     * @return false 常に false
+     */
+    bool fail()
+    {
+        valid_ = false;
+        return false;
+    }
+
+    const uint8_t* pos_   = nullptr;  // 次に読む記録
+    const uint8_t* end_   = nullptr;  // 記録の終端
+    TimestampUs time_us_  = 0;        // 直前の記録の時刻[us]
+    uint32_t entry_count_ = 0;        // 記録数
+    uint32_t read_count_  = 0;        // 読み出した記録数
+    uint8_t flags_        = 0;        // ダンプのフラグ
+    bool valid_           = false;    // ヘッダーが正しく、記録が壊れていないか
+};
+
+/**
+ * @brief 直近の送受信フレームを記録し続けるタップ（故障解析用のフライトレコーダー）
+ *
+ * `BasicBus::add_tap()` で登録すると、送受信フレームを時刻付きで固定長のリングバッファに記録します。
+ * 満杯になると古い記録から上書きするため、常に直近の CapacityBytes 分が残ります。
+ * 1件あたりの処理は数十byteのコピーだけで、動的メモリは使用しません（STM32 でも常時記録できます）。
+ *
+ * トリガー（例: EmergencyStop フレームの受信）を設定すると、その後 post_trigger_frames 個を
+ * 記録した時点で記録を止め (freeze)、故障前後のフレームを保持します。
+ *
+ * @code
+ * gn10_can::CANFlightRecorder<2048> recorder;
+ * recorder.set_trigger([](const gn10_can::CANFrame& frame, gn10_can::TapDirection) {
+ *     return gn10_can::id::unpack(frame.id).type == gn10_can::id::DeviceType::EmergencyStop;
+ * }, 16);
+ * bus.add_tap(recorder);
+ *
+ * // 停止後: recorder.dump(buffer, sizeof(buffer)) を UART やファイルへ書き出す
+ * @endcode
+ *
+ * 時刻はフレームの受信時刻 (Frame::timestamp()) があればそれを、なければバスの時刻を使います。
+ * dump() は update() と同じコンテキストから、または is_frozen() が true になった後に呼んでください。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam CapacityBytes リングバッファのbyte数（2の冪）
+ */
+template <typename Frame, std::size_t CapacityBytes = 1024>
+class BasicFlightRecorder : public BasicTap<Frame>
+{
+    static_assert(
+        (CapacityBytes & (CapacityBytes - 1)) == 0, "CapacityBytes must be a power of two"
+    );
+    static_assert(
+        CapacityBytes >= 2 * flight_record::MAX_ENTRY_SIZE,
+        "CapacityBytes must hold at least two maximum-size entries"
+    );
+    static_assert(Frame::MAX_DLC <= flight_record::MAX_DATA_LENGTH, "Frame data is too long");
+
+public:
+    static constexpr std::size_t CAPACITY_BYTES = CapacityBytes;
+
+    /**
+     * @brief 記録を止めるフレームを判定する関数
+     *
+     */
+    using Trigger = bool (*)(const Frame& frame, TapDirection direction);
+
+    BasicFlightRecorder() = default;
+
+    /**
+     * @brief 記録を止めるトリガーを設定する
+     *
+     * @param trigger トリガーとなるフレームで true を返す関数（nullptr で解除）
+     * @param post_trigger_frames トリガー後に記録を続けるフレーム数
+     */
+    void set_trigger(Trigger trigger, uint16_t post_trigger_frames = 0)
+    {
+        trigger_             = trigger;
+        post_trigger_frames_ = post_trigger_frames;
+    }
+
+    /**
+     * @brief 直ちに記録を止める（ソフトウェアの異常検知時など）
+     *
+     */
+    void freeze()
+    {
+        frozen_ = true;
+    }
+
+    /**
+     * @brief 記録を止めたか確認する
+     *
+     * @return true 停止中
+     * @return false 記録中
+     */
+    bool is_frozen() const
+    {
+        return frozen_;
+    }
+
+    /**
+     * @brief 記録を消去し、記録とトリガーの監視を再開する
+     *
+     */
+    void clear()
+    {
+        head_                   = 0;
+        tail_                   = 0;
+        used_                   = 0;
+        entry_count_            = 0;
+        overwritten_count_      = 0;
+        base_time_us_           = 0;
+        last_time_us_           = 0;
+        post_trigger_remaining_ = 0;
+        triggered_              = false;
+        frozen_                 = false;
+    }
+
+    /**
+     * @brief 残っている記録数を取得する
+     *
+     * @return uint32_t 記録数
+     */
+    uint32_t entry_count() const
+    {
+        return entry_count_;
+    }
+
+    /**
+     * @brief 上書きで失われた記録数を取得する
+     *
+     * @return uint32_t 上書きされた記録数
+     */
+    uint32_t overwritten_count() const
+    {
+        return overwritten_count_;
+    }
+
+    /**
+     * @brief dump() に必要なbyte数を取得する
+     *
+     * @return std::size_t ダンプのbyte数
+     */
+    std::size_t dump_size() const
+    {
+        return flight_record::DUMP_HEADER_SIZE + used_;
+    }
+
+    /**
+     * @brief 記録を古い順に書き出す（形式は flight_record 参照、FlightRecordReader で読み出せる）
+     *
+     * @param out 書き出し先
+     * @param max_size 書き出し先のbyte数（dump_size() 以上）
+     * @return std::size_t 書き出したbyte数（書き出し先が小さい場合は0）
+     */
+    std::size_t dump(uint8_t* out, std::size_t max_size) const
+    {
+        std::size_t size = dump_size();
+        if (out == nullptr || max_size < size) {
+            return 0;
+        }
+        uint8_t flags = 0;
+        if (frozen_) {
+            flags |= flight_record::DUMP_FLAG_FROZEN;
+        }
+        if constexpr (Frame::MAX_DLC > 8) {
+            flags |= flight_record::DUMP_FLAG_FD;
+        }
+        for (std::size_t i = 0; i < flight_record::MAGIC.size(); ++i) {
+            out[i] = flight_record::MAGIC[i];
+        }
+        out[4] = flight_record::VERSION;
+        out[5] = flags;
+        out[6] = 0;
+        out[7] = 0;
+        flight_record::store_u32(out + 8, base_time_us_);
+        flight_record::store_u32(out + 12, entry_count_);
+        flight_record::store_u32(out + 16, static_cast<uint32_t>(used_));
+
+        uint8_t* payload = out + flight_record::DUMP_HEADER_SIZE;
+        for (std::size_t i = 0; i < used_; ++i) {
+            payload[i] = buffer_[(tail_ + i) & INDEX_MASK];
+        }
+        return size;
+    }
+
+    void on_frame(const Frame& frame, TapDirection direction, TimestampUs timestamp_us) override
+    {
+        if (frozen_) {
+            return;
+        }
+        TimestampUs time_us = frame.timestamp();
+        if (time_us == 0) {
+            time_us = timestamp_us;
+        }
+        record(frame, direction, time_us);
+
+        if (!triggered_ && trigger_ != nullptr && trigger_(frame, direction)) {
+            triggered_              = true;
+            post_trigger_remaining_ = post_trigger_frames_;
+        } else if (triggered_ && post_trigger_remaining_ > 0) {
+            post_trigger_remaining_--;
+        }
+        if (triggered_ && post_trigger_remaining_ == 0) {
+            frozen_ = true;
+        }
+    }
+
+private:
+    static constexpr std::size_t INDEX_MASK = CapacityBytes - 1;
+
+    /**
+     * @brief 1件の記録を符号化し、必要なら古い記録を消してリングバッファに書き込む
+     *
+     * @param frame 送受信したフレーム
+     * @param direction フレームの方向
+     * @param time_us 時刻[us]
+     */
+    void record(const Frame& frame, TapDirection direction, TimestampUs time_us)
+    {
+        std::array<uint8_t, flight_record::MAX_ENTRY_SIZE> entry;
+        std::size_t size = 1;
+
+        std::size_t length = frame.dlc;
+        if (length > Frame::MAX_DLC) {
+            length = Frame::MAX_DLC;
+        }
+        uint8_t header = 0;
+        if (direction == TapDirection::Tx) {
+            header |= flight_record::FLAG_TX;
+        }
+        if (frame.is_extended) {
+            header |= flight_record::FLAG_EXTENDED;
+        }
+        if (length > flight_record::LENGTH_MASK) {
+            header |= flight_record::FLAG_LONG_LENGTH;
+        } else {
+            header |= static_cast<uint8_t>(length);
+        }
+        entry[0] = header;
+
+        int32_t delta_us = static_cast<int32_t>(time_us - last_time_us_);
+        uint32_t zigzag  = flight_record::zigzag_encode(delta_us);
+        while (zigzag >= 0x80) {
+            entry[size++] = static_cast<uint8_t>(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        entry[size++] = static_cast<uint8_t>(zigzag);
+
+        std::size_t id_size = 2;
+        if (frame.is_extended) {
+            id_size = 4;
+        }
+        for (std::size_t i = 0; i < id_size; ++i) {
+            entry[size++] = static_cast<uint8_t>(frame.id >> (8 * i));
+        }
+        if (length > flight_record::LENGTH_MASK) {
+            entry[size++] = static_cast<uint8_t>(length);
+        }
+        for (std::size_t i = 0; i < length; ++i) {
+            entry[size++] = frame.data[i];
+        }
+
+        while (CapacityBytes - used_ < size) {
+            drop_oldest();
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+            buffer_[(head_ + i) & INDEX_MASK] = entry[i];
+        }
+        head_ = (head_ + size) & INDEX_MASK;
+        used_ += size;
+        entry_count_++;
+        last_time_us_ = time_us;
+    }
+
+    /**
+     * @brief 最も古い記録を消す（ダンプの基準時刻は消した記録の時刻に進める）
+     *
+     */
+    void drop_oldest()
+    {
+        uint8_t header  = buffer_[tail_];
+        std::size_t pos = tail_ + 1;
+
+        uint32_t zigzag   = 0;
+        std::size_t shift = 0;
+        uint8_t byte      = 0;
+        do {
+            byte = buffer_[pos & INDEX_MASK];
+            pos++;
+            zigzag |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while ((byte & 0x80) != 0);
+
+        if ((header & flight_record::FLAG_EXTENDED) != 0) {
+            pos += 4;
+        } else {
+            pos += 2;
+        }
+        std::size_t length = header & flight_record::LENGTH_MASK;
+        if ((header & flight_record::FLAG_LONG_LENGTH) != 0) {
+            length = buffer_[pos & INDEX_MASK];
+            pos++;
+        }
+        pos += length;
+
+        base_time_us_ += static_cast<TimestampUs>(flight_record::zigzag_decode(zigzag));
+        used_ -= pos - tail_;
+        tail_ = pos & INDEX_MASK;
+        entry_count_--;
+        overwritten_count_++;
+    }
+
+    std::array<uint8_t, CapacityBytes> buffer_{};  // 記録のリングバッファ
+    std::size_t head_                = 0;          // 次に書き込む位置
+    std::size_t tail_                = 0;          // 最も古い記録の位置
+    std::size_t used_                = 0;          // 使用中のbyte数
+    uint32_t entry_count_            = 0;          // 残っている記録数
+    uint32_t overwritten_count_      = 0;          // 上書きされた記録数
+    TimestampUs base_time_us_        = 0;          // 最も古い記録の時刻差の基準[us]
+    TimestampUs last_time_us_        = 0;          // 最後に記録した時刻[us]
+    Trigger trigger_                 = nullptr;    // 記録を止めるトリガー
+    uint16_t post_trigger_frames_    = 0;          // トリガー後に記録するフレーム数
+    uint16_t post_trigger_remaining_ = 0;          // トリガー後に残りの記録するフレーム数
+    bool triggered_                  = false;      // トリガーを検出したか
+    bool frozen_                     = false;      // 記録を止めたか
+};
+
+template <std::size_t CapacityBytes = 1024>
+using CANFlightRecorder = BasicFlightRecorder<CANFrame, CapacityBytes>;
+
+template <std::size_t CapacityBytes = 4096>
+using FDCANFlightRecorder = BasicFlightRecorder<FDCANFrame, CapacityBytes>;
+
+}  // namespace gn10_can
@@ -0,0 +1,323 @@
+/**
+ * @file frame_awaiter.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信フレームを C++20 コルーチンで待つためのヘッダーファイル (Linux / ROS 2 ホスト向け)
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "frame_awaiter.hpp requires C++20 coroutines (-std=c++20)"
+#endif
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
+#include "gn10_can/core/timestamp.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 起動と同時に実行を始めるコルーチンの戻り値型
+ *
+ * co_await で中断したコルーチンは、Task が破棄されると一緒に破棄されます。
+ * コルーチンフレームの確保は処理系の既定のアロケータに従います。
+ */
+class Task
+{
+public:
+    struct promise_type {
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception()
+        {
+            std::terminate();  // 本ライブラリは例外を使用しない
+        }
+    };
+
+    Task(Task&& other) noexcept : handle_(other.handle_)
+    {
+        other.handle_ = nullptr;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&)      = delete;
+
+    ~Task()
+    {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /**
+     * @brief コルーチンが最後まで実行されたか確認する
+     *
+     * @return true 完了した
+     * @return false 中断中
+     */
+    bool done() const
+    {
+        return !handle_ || handle_.done();
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;  // 実行中のコルーチン
+};
+
+/**
+ * @brief 指定したIDのフレームの受信を co_await で待てるようにするタップ
+ *
+ * `BasicBus::add_tap()` で登録し、バスの update() の後に poll() を呼びます。
+ * 受信したフレームは update() 中に記録され、poll() で待機中のコルーチンを再開します
+ * （デバイスの受信処理が終わった後に再開されるため、再開後はクライアントの getter も最新です）。
+ * 期限を過ぎた待機は std::nullopt で再開されます。
+ *
+ * 待機中のコルーチンは固定長のプールで管理し、動的メモリは使用しません。
+ * プールが満杯の場合、co_await は中断せず直ちに std::nullopt を返します。
+ *
+ * @code
+ * gn10_can::Task wait_feedback(gn10_can::CANFrameAwaiter<>& awaiter)
+ * {
+ *     auto frame = co_await awaiter.next_frame(
+ *         id::DeviceType::MotorDriver, 0, id::MsgTypeMotorDriver::Feedback, 10000);
+ *     if (!frame) {
+ *         // タイムアウト
+ *     }
+ * }
+ * @endcode
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam MaxWaiters 同時に待機できるコルーチンの最大数
+ */
+template <typename Frame, std::size_t MaxWaiters = 8>
+class BasicFrameAwaiter : public BasicTap<Frame>
+{
+public:
+    static constexpr std::size_t MAX_WAITERS = MaxWaiters;
+
+    /**
+     * @brief co_await で受信を待つためのオブジェクト（co_await の結果は std::optional<Frame>）
+     *
+     */
+    class Awaitable
+    {
+    public:
+        Awaitable(BasicFrameAwaiter& owner, uint32_t id, TimestampUs timeout_us)
+            : owner_(owner), id_(id), timeout_us_(timeout_us)
+        {
+        }
+
+        Awaitable(const Awaitable&)            = delete;
+        Awaitable& operator=(const Awaitable&) = delete;
+
+        ~Awaitable()
+        {
+            // 待機中のままコルーチンが破棄された場合、プールの枠を返す
+            if (slot_ != NO_SLOT) {
+                owner_.waiters_[slot_].state = WaiterState::Free;
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            slot_ = owner_.acquire(id_, timeout_us_, handle);
+            return slot_ != NO_SLOT;  // プール満杯なら中断せず await_resume() へ
+        }
+
+        std::optional<Frame> await_resume()
+        {
+            if (slot_ == NO_SLOT) {
+                return std::nullopt;
+            }
+            Waiter& waiter = owner_.waiters_[slot_];
+            std::optional<Frame> result;
+            if (waiter.state == WaiterState::Received) {
+                result = waiter.frame;
+            }
+            waiter.state = WaiterState::Free;
+            slot_        = NO_SLOT;
+            return result;
+        }
+
+    private:
+        BasicFrameAwaiter& owner_;    // 待機を管理するタップ
+        uint32_t id_;                 // 待つフレームのID
+        TimestampUs timeout_us_;      // タイムアウト[us]
+        std::size_t slot_ = NO_SLOT;  // 使用中のプールの枠
+    };
+
+    /**
+     * @brief コンストラクタ
+     *
+     * @param time_source タイムアウト判定に使う現在時刻[us]を返す関数
+     */
+    explicit BasicFrameAwaiter(TimeSourceUs time_source) : time_source_(time_source) {}
+
+    /**
+     * @brief 指定したIDのフレームの次の受信を待つ
+     *
+     * @param id 待つフレームのCAN ID
+     * @param timeout_us タイムアウト[us]
+     * @return Awaitable co_await すると受信したフレーム（タイムアウト・プール満杯時は std::nullopt）
+     */
+    Awaitable next_frame(uint32_t id, TimestampUs timeout_us)
+    {
+        return Awaitable(*this, id, timeout_us);
+    }
+
+    /**
+     * @brief 指定したデバイス・コマンドのフレームの次の受信を待つ
+     *
+     * @param type デバイスの種類
+     * @param dev_id デバイスID
+     * @param command コマンド
+     * @param timeout_us タイムアウト[us]
+     * @return Awaitable co_await すると受信したフレーム（タイムアウト・プール満杯時は std::nullopt）
+     */
+    template <typename CmdEnum>
+    Awaitable next_frame(
+        id::DeviceType type, uint8_t dev_id, CmdEnum command, TimestampUs timeout_us
+    )
+    {
+        return Awaitable(*this, id::pack(type, dev_id, command), timeout_us);
+    }
+
+    /**
+     * @brief 受信済み・期限切れの待機中コルーチンを再開する（バスの update() の後に呼び出す）
+     *
+     * @return std::size_t 再開したコルーチン数
+     */
+    std::size_t poll()
+    {
+        TimestampUs now    = time_source_();
+        std::size_t resumed = 0;
+        for (Waiter& waiter : waiters_) {
+            if (waiter.state == WaiterState::Waiting &&
+                static_cast<int32_t>(now - waiter.deadline_us) >= 0) {
+                waiter.state = WaiterState::TimedOut;
+            }
+            if (waiter.state == WaiterState::Received || waiter.state == WaiterState::TimedOut) {
+                waiter.handle.resume();  // await_resume() で枠が返される
+                resumed++;
+            }
+        }
+        return resumed;
+    }
+
+    /**
+     * @brief 待機中のコルーチン数を取得する
+     *
+     * @return std::size_t 待機中のコルーチン数
+     */
+    std::size_t pending() const
+    {
+        std::size_t count = 0;
+        for (const Waiter& waiter : waiters_) {
+            if (waiter.state != WaiterState::Free) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    void on_frame(const Frame& frame, TapDirection direction, TimestampUs) override
+    {
+        if (direction != TapDirection::Rx) {
+            return;
+        }
+        for (Waiter& waiter : waiters_) {
+            if (waiter.state == WaiterState::Waiting && waiter.id == frame.id) {
+                waiter.frame = frame;
+                waiter.state = WaiterState::Received;
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t NO_SLOT = MaxWaiters;  // プールの枠を使っていない
+
+    enum class WaiterState : uint8_t {
+        Free,      // 未使用
+        Waiting,   // 受信待ち
+        Received,  // 受信済み（poll() で再開）
+        TimedOut,  // 期限切れ（poll() で再開）
+    };
+
+    struct Waiter {
+        std::coroutine_handle<> handle;               // 再開するコルーチン
+        Frame frame{};                                // 受信したフレーム
+        uint32_t id             = 0;                  // 待つフレームのID
+        TimestampUs deadline_us = 0;                  // 期限[us]
+        WaiterState state       = WaiterState::Free;  // 待機の状態
+    };
+
+    /**
+     * @brief プールの空き枠に待機を登録する
+     *
+     * @param id 待つフレームのID
+     * @param timeout_us タイムアウト[us]
+     * @param handle 再開するコルーチン
+     * @return std::size_t 登録した枠（満杯の場合は NO_SLOT）
+     */
+    std::size_t acquire(uint32_t id, TimestampUs timeout_us, std::coroutine_handle<> handle)
+    {
+        for (std::size_t i = 0; i < MaxWaiters; ++i) {
+            Waiter& waiter = waiters_[i];
+            if (waiter.state == WaiterState::Free) {
+                waiter.handle      = handle;
+                waiter.id          = id;
+                waiter.deadline_us = time_source_() + timeout_us;
+                waiter.state       = WaiterState::Waiting;
+                return i;
+            }
+        }
+        return NO_SLOT;
+    }
+
+    TimeSourceUs time_source_;                  // 現在時刻の取得元
+    std::array<Waiter, MaxWaiters> waiters_{};  // 待機中のコルーチンのプール
+};
+
+template <std::size_t MaxWaiters = 8>
+using CANFrameAwaiter = BasicFrameAwaiter<CANFrame, MaxWaiters>;
+
+template <std::size_t MaxWaiters = 8>
+using FDCANFrameAwaiter = BasicFrameAwaiter<FDCANFrame, MaxWaiters>;
+
+}  // namespace gn10_can
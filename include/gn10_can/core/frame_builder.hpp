@@ -0,0 +1,284 @@
+/**
+ * @file frame_builder.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 送信フレームをバスの送信領域に直接書き込むビルダーのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "gn10_can/core/bus_interface.hpp"
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 送信フレームをバスの送信領域に直接書き込むビルダー
+ *
+ * Frame::make() のように作成したフレームを値で受け渡さず、バスから確保した送信領域へ
+ * データを先頭から順に書き込み、commit() で送信します。データ部は書き込んだ範囲と
+ * DLC の詰め物 (CAN FD の 12〜64byte) だけを書き換え、残りの領域は0で埋めません。
+ *
+ * commit() せずに破棄した場合は送信せずに領域を返却します。BasicBus / BasicStaticBus の送信領域は
+ * 1つのバスにつき2つのため、同じバスのビルダーを同時に3つ使うと3つ目は確保に失敗します (ok() が false)。
+ * BasicDevice::send() / IBus::send_frame() は送信領域を使わないため、ビルダーの保持中も送信できます。
+ *
+ * @code
+ * FDCANFrameBuilder tx(bus, id::pack(id::DeviceType::ESCHub, 0, id::MsgTypeESCHub::Gain));
+ * tx.write(config);
+ * tx.commit();
+ * @endcode
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ */
+template <typename Frame>
+class BasicFrameBuilder
+{
+public:
+    /**
+     * @brief バスの送信領域を確保し、CAN ID を書き込む
+     *
+     * @param bus 送信するバス
+     * @param id CAN ID
+     * @param is_extended 拡張IDか
+     */
+    BasicFrameBuilder(IBus<Frame>& bus, uint32_t id, bool is_extended = false)
+        : bus_(bus), slot_(bus.acquire_tx_slot())
+    {
+        ok_ = slot_.frame != nullptr;
+        if (ok_) {
+            // 送信領域は使い回すため、前のフレームのフラグを残さない
+            slot_.frame->id              = id;
+            slot_.frame->is_extended     = is_extended;
+            slot_.frame->is_fd           = Frame::MAX_DLC > 8;
+            slot_.frame->bit_rate_switch = false;
+            slot_.frame->set_timestamp(0);
+        }
+    }
+
+    ~BasicFrameBuilder()
+    {
+        if (slot_.frame != nullptr) {
+            bus_.cancel_tx_slot(slot_);
+        }
+    }
+
+    // コピーとムーブを禁止 (確保した送信領域を1つのビルダーだけが持つため)
+    BasicFrameBuilder(const BasicFrameBuilder&)            = delete;
+    BasicFrameBuilder& operator=(const BasicFrameBuilder&) = delete;
+    BasicFrameBuilder(BasicFrameBuilder&&)                 = delete;
+    BasicFrameBuilder& operator=(BasicFrameBuilder&&)      = delete;
+
+    /**
+     * @brief データ部の続きに length byte の領域を確保し、その先頭を返す
+     *
+     * 返した領域は commit() まで呼び出し側が直接書き込めます（内容は不定）。
+     *
+     * @param length 確保するバイト数
+     * @return uint8_t* 確保した領域の先頭（MAX_DLC を超える場合は nullptr、以降の commit() は失敗）
+     */
+    uint8_t* claim(std::size_t length)
+    {
+        if (!ok_ || length > Frame::MAX_DLC - size_) {
+            ok_ = false;
+            return nullptr;
+        }
+        uint8_t* out = slot_.frame->data.data() + size_;
+        size_ += length;
+        return out;
+    }
+
+    /**
+     * @brief データ部の続きにバイト列を書き込む
+     *
+     * @param bytes 書き込むデータ
+     * @param length データの長さ[byte]
+     * @return true 書き込み成功
+     * @return false MAX_DLC を超えるため書き込めなかった（以降の commit() は失敗する）
+     */
+    bool write_bytes(const void* bytes, std::size_t length)
+    {
+        uint8_t* out = claim(length);
+        if (out == nullptr) {
+            return false;
+        }
+        std::memcpy(out, bytes, length);
+        return true;
+    }
+
+    /**
+     * @brief データ部の続きに値をそのままのバイト列で書き込む（converter::pack() と同じ形式）
+     *
+     * @tparam T 書き込む値の型（トリビアルにコピー可能な型）
+     * @param value 書き込む値
+     * @return true 書き込み成功
+     * @return false MAX_DLC を超えるため書き込めなかった（以降の commit() は失敗する）
+     */
+    template <typename T>
+    bool write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        return write_bytes(&value, sizeof(T));
+    }
+
+    /**
+     * @brief データ部の続きに値の配列をまとめて書き込む（範囲の確認は1度だけ）
+     *
+     * @tparam T 書き込む値の型（トリビアルにコピー可能な型）
+     * @param values 書き込む値の配列
+     * @param count 要素数
+     * @return true 書き込み成功
+     * @return false MAX_DLC を超えるため書き込めなかった（以降の commit() は失敗する）
+     */
+    template <typename T>
+    bool write(const T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        if (count > Frame::MAX_DLC / sizeof(T)) {
+            ok_ = false;
+            return false;
+        }
+        return write_bytes(values, sizeof(T) * count);
+    }
+
+    /**
+     * @brief CAN FD のデータフェーズをデータビットレートで送るか (BRS) を設定する
+     *
+     * クラシックCANのフレーム、または CAN FD フォーマットで送らないフレームでは無視されます。
+     *
+     * @param enable BRS を有効にするか
+     */
+    void set_bit_rate_switch(bool enable)
+    {
+        if (slot_.frame != nullptr) {
+            slot_.frame->bit_rate_switch = enable;
+        }
+    }
+
+    /**
+     * @brief 書き込んだデータ長を取得する
+     *
+     * @return std::size_t データ長[byte]
+     */
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief 送信領域を確保でき、書き込みが全て MAX_DLC に収まっているか
+     *
+     * @return true commit() で送信できる
+     * @return false 確保失敗、または書き込みが溢れた
+     */
+    bool ok() const
+    {
+        return ok_;
+    }
+
+    /**
+     * @brief DLC を確定し、フレームを送信する
+     *
+     * 書き込んだデータ長を DLC で表せる長さに切り上げ、詰め物を0で埋めます。ok() が false の場合は送信せずに
+     * 領域を返却します。2回目以降の呼び出しは失敗します。
+     *
+     * @param mode 送信キューでの扱い方
+     * @return true 送信成功（IBus::send_frame() と同じ）
+     * @return false 送信失敗
+     */
+    bool commit(TxMode mode = TxMode::Deliver)
+    {
+        if (slot_.frame == nullptr) {
+            return false;
+        }
+        if (!ok_) {
+            bus_.cancel_tx_slot(slot_);
+            slot_.frame = nullptr;
+            return false;
+        }
+
+        std::size_t padded = Frame::padded_length(size_);
+        if (size_ < padded) {
+            uint8_t* data = slot_.frame->data.data();
+            std::fill(data + size_, data + padded, static_cast<uint8_t>(0));
+        }
+        slot_.frame->dlc = static_cast<uint8_t>(padded);
+        ok_              = false;
+        bool sent        = bus_.commit_tx_slot(slot_, mode);
+        slot_.frame      = nullptr;
+        return sent;
+    }
+
+private:
+    IBus<Frame>& bus_;          // 送信するバス
+    TxSlot<Frame> slot_;        // 確保した送信領域（返却後は frame が nullptr）
+    std::size_t size_ = 0;      // 書き込んだデータ長[byte]
+    bool ok_          = false;  // 送信できる状態か
+};
+
+using CANFrameBuilder   = BasicFrameBuilder<CANFrame>;
+using FDCANFrameBuilder = BasicFrameBuilder<FDCANFrame>;
+
+namespace detail {
+
+/**
+ * @brief バスが持つ送信フレームの書き込み領域（固定数のプール）
+ *
+ * BasicFrameBuilder はここに直接書き込み、バスは commit 時にこのフレームから直接送信します。
+ * 送信中（タップの通知中など）にもう1つのビルダーが確保できるよう、既定で2つ持ちます。
+ * フレームは使い回すため、確保のたびに0で埋めることはしません。
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Count 領域の数
+ */
+template <typename Frame, std::size_t Count = 2>
+class TxStagingPool
+{
+public:
+    /**
+     * @brief 空いている書き込み領域を確保する
+     *
+     * @return TxSlot<Frame> 確保した領域（全て使用中の場合は frame が nullptr）
+     */
+    TxSlot<Frame> acquire()
+    {
+        TxSlot<Frame> slot;
+        for (std::size_t i = 0; i < Count; i++) {
+            if (!in_use_[i]) {
+                in_use_[i] = true;
+                slot.frame = &frames_[i];
+                slot.token = i;
+                break;
+            }
+        }
+        return slot;
+    }
+
+    /**
+     * @brief 書き込み領域を返却する
+     *
+     * @param slot acquire() で確保した領域
+     */
+    void release(const TxSlot<Frame>& slot)
+    {
+        in_use_[slot.token] = false;
+    }
+
+private:
+    std::array<Frame, Count> frames_{};  // 書き込み先のフレーム
+    std::array<bool, Count> in_use_{};   // ビルダーが使用中か
+};
+
+}  // namespace detail
+}  // namespace gn10_can
@@ -0,0 +1,124 @@
+/**
+ * @file frame_cost.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フレームが実際にバスを占有するビット数（ビットスタッフィング込み）の計算
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace gn10_can {
+namespace frame_cost {
+
+/**
+ * @brief スタッフビットの数え方
+ *
+ */
+enum class Stuffing : uint8_t {
+    Actual,     // フレームの内容（ID・データ・CRC）から実際に挿入されるスタッフビットを数える
+    WorstCase,  // 挿入され得る最大数とする（計算は O(1)）
+    None,       // スタッフビットを数えない
+};
+
+/**
+ * @brief 1フレームのビット数（フレーム間スペース3bitを含む）
+ *
+ * CAN FD でビットレートスイッチ (BRS) を使う場合、ESI からCRCフィールドまでが data_bits、
+ * それ以外が nominal_bits になります。クラシックCANと BRS なしの CAN FD はすべて nominal_bits です。
+ */
+struct BitCount {
+    uint32_t nominal_bits = 0;  // 調停ビットレートで送られるビット数
+    uint32_t data_bits    = 0;  // データビットレートで送られるビット数
+};
+
+/**
+ * @brief クラシックCANのデータフレームのビット数を計算する
+ *
+ * @param id CAN ID
+ * @param is_extended 拡張IDか
+ * @param data データ
+ * @param length データ長（8を超える分は数えない）
+ * @param stuffing スタッフビットの数え方
+ * @return BitCount ビット数（すべて nominal_bits）
+ */
+BitCount classic_bits(
+    uint32_t id, bool is_extended, const uint8_t* data, std::size_t length, Stuffing stuffing
+);
+
+/**
+ * @brief CAN FD のデータフレームのビット数を計算する
+ *
+ * データ長が CAN FD の DLC で表せない長さ（例: 10byte）の場合は、次に大きい長さに詰め物をして数えます。
+ * CRCフィールドの固定スタッフビット（CRC17 で6bit、CRC21 で7bit）を含みます。
+ *
+ * @param id CAN ID
+ * @param is_extended 拡張IDか
+ * @param data データ
+ * @param length データ長（64を超える分は数えない）
+ * @param bit_rate_switch ビットレートスイッチ (BRS) を使うか
+ * @param stuffing スタッフビットの数え方
+ * @return BitCount 調停フェーズとデータフェーズのビット数
+ */
+BitCount fd_bits(
+    uint32_t id,
+    bool is_extended,
+    const uint8_t* data,
+    std::size_t length,
+    bool bit_rate_switch,
+    Stuffing stuffing
+);
+
+/**
+ * @brief CAN FD の DLC で表せる、length 以上の最小のデータ長を取得する
+ *
+ * @param length データ長[byte]
+ * @return std::size_t 送信されるデータ長（0〜8, 12, 16, 20, 24, 32, 48, 64）
+ */
+std::size_t fd_padded_length(std::size_t length);
+
+/**
+ * @brief フレームのビット数を計算する（フレームの is_fd から CAN / CAN FD を選ぶ）
+ *
+ * @tparam Frame CANFrame / FDCANFrame
+ * @param frame フレーム
+ * @param bit_rate_switch バスがデータビットレートを使うか（フレームの bit_rate_switch も真の場合のみ BRS）
+ * @param stuffing スタッフビットの数え方
+ * @return BitCount ビット数
+ */
+template <typename Frame>
+BitCount frame_bits(const Frame& frame, bool bit_rate_switch, Stuffing stuffing)
+{
+    if constexpr (Frame::MAX_DLC > 8) {
+        if (frame.is_fd) {
+            return fd_bits(
+                frame.id,
+                frame.is_extended,
+                frame.data.data(),
+                frame.dlc,
+                bit_rate_switch && frame.bit_rate_switch,
+                stuffing
+            );
+        }
+    }
+    (void)bit_rate_switch;
+    return classic_bits(frame.id, frame.is_extended, frame.data.data(), frame.dlc, stuffing);
+}
+
+/**
+ * @brief ビット数をバスの占有時間に換算する
+ *
+ * @param bits ビット数
+ * @param nominal_bitrate 調停ビットレート[bit/s]
+ * @param data_bitrate データビットレート[bit/s]（0 の場合は nominal_bitrate）
+ * @return uint32_t 占有時間[ns]
+ */
+uint32_t duration_ns(const BitCount& bits, uint32_t nominal_bitrate, uint32_t data_bitrate);
+
+}  // namespace frame_cost
+}  // namespace gn10_can
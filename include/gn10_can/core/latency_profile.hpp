@@ -0,0 +1,96 @@
+/**
+ * @file latency_profile.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief バスの update() / 送信 / 受信ハンドラーの処理時間のヒストグラム
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/can_id.hpp"
+#include "gn10_can/utils/cycle_counter.hpp"
+#include "gn10_can/utils/latency_histogram.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief バスが記録する処理時間のヒストグラム一式
+ *
+ * `GN10_CAN_ENABLE_LATENCY_PROFILE` を定義した場合のみ、BasicBus::latency_profile() で取得できます。
+ * 値の単位は BasicBus::set_cycle_counter() で登録したカウンタに従います。
+ */
+class LatencyProfile
+{
+public:
+    static constexpr std::size_t DEVICE_TYPE_COUNT = 1u << id::BIT_WIDTH_DEV_TYPE;
+
+    // 記録先の番号（0 〜 DEVICE_TYPE_COUNT - 1 はデバイスの種類ごとの受信処理）
+    static constexpr std::size_t UPDATE     = DEVICE_TYPE_COUNT;      // update() 1回
+    static constexpr std::size_t SEND       = DEVICE_TYPE_COUNT + 1;  // send_frame() 1回
+    static constexpr std::size_t SITE_COUNT = DEVICE_TYPE_COUNT + 2;  // 記録先の数
+
+    /**
+     * @brief update() 1回（送信キューの flush を含む）の処理時間を取得する
+     *
+     * @return const utils::LatencyHistogram& ヒストグラム
+     */
+    const utils::LatencyHistogram& update() const
+    {
+        return histograms_[UPDATE];
+    }
+
+    /**
+     * @brief send_frame() 1回の処理時間を取得する
+     *
+     * @return const utils::LatencyHistogram& ヒストグラム
+     */
+    const utils::LatencyHistogram& send() const
+    {
+        return histograms_[SEND];
+    }
+
+    /**
+     * @brief デバイスの種類ごとの受信処理（コマンドハンドラー・on_receive()）の処理時間を取得する
+     *
+     * @param type デバイスの種類
+     * @return const utils::LatencyHistogram& ヒストグラム
+     */
+    const utils::LatencyHistogram& handler(id::DeviceType type) const
+    {
+        return histograms_[static_cast<std::size_t>(type) & (DEVICE_TYPE_COUNT - 1)];
+    }
+
+    /**
+     * @brief 記録先のヒストグラムを取得する（バスの記録用）
+     *
+     * @param site 記録先の番号（デバイスの種類、UPDATE、SEND のいずれか）
+     * @return utils::LatencyHistogram& ヒストグラム
+     */
+    utils::LatencyHistogram& at(std::size_t site)
+    {
+        return histograms_[site];
+    }
+
+    /**
+     * @brief すべてのヒストグラムを消去する
+     *
+     */
+    void reset()
+    {
+        for (utils::LatencyHistogram& histogram : histograms_) {
+            histogram.reset();
+        }
+    }
+
+private:
+    std::array<utils::LatencyHistogram, SITE_COUNT> histograms_{};  // 記録先ごとのヒストグラム
+};
+
+}  // namespace gn10_can
@@ -0,0 +1,261 @@
+/**
+ * @file routing_table.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ルーティングID(8bit)からデバイスを直接引くためのルーティングテーブルのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/can_id.hpp"
+
+namespace gn10_can {
+namespace detail {
+
+// ルーティングID (DeviceType + DeviceID, 8bit) の種類数
+static constexpr std::size_t ROUTING_ID_COUNT = std::size_t{1}
+                                                << (id::BIT_WIDTH_DEV_TYPE + id::BIT_WIDTH_DEV_ID);
+
+/**
+ * @brief ルーティングID(DeviceType + DeviceID)から、同じIDを持つデバイスのリストを引くテーブル
+ *
+ * 各エントリは同じルーティングIDを持つデバイスの双方向リスト(侵入型)の先頭を指します。
+ * リストのリンクはデバイス側の `route_next_` / `route_prev_` メンバに保持するため、動的メモリは使用しません。
+ * 先頭の `route_prev_` は末尾を指すので、リストへの追加・削除とも O(1) です。
+ *
+ * 先頭の持ち方は Capacity に応じて、RAM が最も小さくなるものを選びます。
+ * - LINEAR_MAX_CAPACITY 以下: 使用中のルーティングIDと先頭の組を Capacity 個持ち、線形探索します。
+ * - DENSE_MIN_CAPACITY 未満: ルーティングID → 先頭の位置 (1byte) の索引 (256byte) と
+ *   Capacity + 1 個の先頭を持ち、配列を2回引きます。
+ * - それ以上: ルーティングIDを添字とする256個の先頭を持ち、配列を1回引きます。
+ *
+ * @tparam Device `get_routing_id()` と `Device* route_next_` / `Device* route_prev_` を持つデバイス型
+ * @tparam Capacity 登録できる最大デバイス数（使用中のルーティングIDの数の上限）
+ */
+template <typename Device, std::size_t Capacity = ROUTING_ID_COUNT>
+class RoutingTable
+{
+public:
+    static constexpr std::size_t SIZE = ROUTING_ID_COUNT;
+
+    // 線形探索にする容量の上限（数件なら索引 256byte を持つより小さく、探索も数回で終わる）
+    static constexpr std::size_t LINEAR_MAX_CAPACITY = 4;
+    // 先頭の配列にする容量の下限（索引 256byte と先頭 Capacity 個が、先頭256個以上になる容量）
+    static constexpr std::size_t DENSE_MIN_CAPACITY =
+        (SIZE * sizeof(Device*) - SIZE) / sizeof(Device*);
+
+    static constexpr bool LINEAR = Capacity <= LINEAR_MAX_CAPACITY;
+    static constexpr bool DENSE  = Capacity >= DENSE_MIN_CAPACITY;
+
+    /**
+     * @brief デバイスをテーブルに登録する
+     *
+     * 同じルーティングIDのデバイスが既にある場合は、リストの末尾に追加します（登録順で配送）。
+     *
+     * @param device 登録するデバイス
+     * @return true 登録成功
+     * @return false 登録失敗（ルーティングIDが範囲外、または使用中のルーティングIDが Capacity 個）
+     */
+    bool insert(Device* device)
+    {
+        uint32_t routing_id = device->get_routing_id();
+        if (routing_id >= SIZE) {
+            return false;
+        }
+        Device** head = add_head(routing_id);
+        if (head == nullptr) {
+            return false;
+        }
+
+        device->route_next_ = nullptr;
+        if (*head == nullptr) {
+            device->route_prev_ = device;
+            *head               = device;
+            return true;
+        }
+        Device* tail         = (*head)->route_prev_;
+        tail->route_next_    = device;
+        device->route_prev_  = tail;
+        (*head)->route_prev_ = device;
+        return true;
+    }
+
+    /**
+     * @brief デバイスをテーブルから削除する
+     *
+     * @param device 削除するデバイス（insert() に成功したデバイスであること）
+     */
+    void remove(Device* device)
+    {
+        uint32_t routing_id = device->get_routing_id();
+        if (routing_id >= SIZE) {
+            return;
+        }
+        Device** head = find_head(routing_id);
+        if (head == nullptr) {
+            return;
+        }
+
+        Device* next = device->route_next_;
+        if (device == *head) {
+            *head = next;
+            if (next != nullptr) {
+                next->route_prev_ = device->route_prev_;
+            }
+        } else {
+            device->route_prev_->route_next_ = next;
+            if (next != nullptr) {
+                next->route_prev_ = device->route_prev_;
+            } else {
+                (*head)->route_prev_ = device->route_prev_;  // 末尾を削除した
+            }
+        }
+        device->route_next_ = nullptr;
+        device->route_prev_ = nullptr;
+        if (*head == nullptr) {
+            remove_head(routing_id);
+        }
+    }
+
+    /**
+     * @brief ルーティングIDに対応するデバイスリストの先頭を取得する
+     *
+     * @param routing_id ルーティングID
+     * @return Device* リストの先頭（該当なし・範囲外の場合は nullptr）
+     */
+    Device* find(uint32_t routing_id) const
+    {
+        if constexpr (LINEAR) {
+            for (std::size_t i = 0; i < count_; i++) {
+                if (ids_[i] == routing_id) {
+                    return heads_[i];
+                }
+            }
+            return nullptr;
+        } else {
+            if (routing_id >= SIZE) {
+                return nullptr;
+            }
+            if constexpr (DENSE) {
+                return heads_[routing_id];
+            } else {
+                return heads_[index_[routing_id]];  // 未使用のIDは常に nullptr の heads_[0] を指す
+            }
+        }
+    }
+
+    /**
+     * @brief 同じルーティングIDを持つ次のデバイスを取得する
+     *
+     * @param device 現在のデバイス
+     * @return Device* 次のデバイス（末尾の場合は nullptr）
+     */
+    static Device* next(const Device* device)
+    {
+        return device->route_next_;
+    }
+
+private:
+    // 先頭の数（索引を使う場合は、未使用のIDが指す nullptr の分を先頭に1つ足す）
+    static constexpr std::size_t HEAD_COUNT = DENSE ? SIZE : (LINEAR ? Capacity : Capacity + 1);
+    // 線形探索で使うルーティングIDの数
+    static constexpr std::size_t ID_COUNT = LINEAR ? Capacity : 0;
+    // ルーティングIDから先頭の位置を引く索引の大きさ
+    static constexpr std::size_t INDEX_SIZE = (LINEAR || DENSE) ? 0 : SIZE;
+
+    /**
+     * @brief ルーティングIDのリスト先頭の格納先を取得する
+     *
+     * @param routing_id ルーティングID（範囲内であること）
+     * @return Device** 格納先（線形探索・索引で未使用のIDは nullptr）
+     */
+    Device** find_head(uint32_t routing_id)
+    {
+        if constexpr (LINEAR) {
+            for (std::size_t i = 0; i < count_; i++) {
+                if (ids_[i] == routing_id) {
+                    return &heads_[i];
+                }
+            }
+            return nullptr;
+        } else if constexpr (DENSE) {
+            return &heads_[routing_id];
+        } else {
+            if (index_[routing_id] == 0) {
+                return nullptr;
+            }
+            return &heads_[index_[routing_id]];
+        }
+    }
+
+    /**
+     * @brief ルーティングIDのリスト先頭の格納先を取得し、なければ割り当てる
+     *
+     * @param routing_id ルーティングID（範囲内であること）
+     * @return Device** 格納先（空きがない場合は nullptr）
+     */
+    Device** add_head(uint32_t routing_id)
+    {
+        Device** head = find_head(routing_id);
+        if (head != nullptr || count_ >= Capacity) {
+            return head;
+        }
+        if constexpr (LINEAR) {
+            ids_[count_]   = static_cast<uint8_t>(routing_id);
+            heads_[count_] = nullptr;
+            return &heads_[count_++];
+        } else if constexpr (!DENSE) {
+            std::size_t slot   = ++count_;  // heads_[0] は未使用のID用
+            index_[routing_id] = static_cast<uint8_t>(slot);
+            heads_[slot]       = nullptr;
+            return &heads_[slot];
+        } else {
+            return head;
+        }
+    }
+
+    /**
+     * @brief 空になったリスト先頭の格納先を解放する（線形探索・索引の場合、末尾の要素で詰める）
+     *
+     * @param routing_id 空になったルーティングID
+     */
+    void remove_head(uint32_t routing_id)
+    {
+        if constexpr (LINEAR) {
+            for (std::size_t i = 0; i < count_; i++) {
+                if (ids_[i] == routing_id) {
+                    count_--;
+                    ids_[i]   = ids_[count_];
+                    heads_[i] = heads_[count_];
+                    return;
+                }
+            }
+        } else if constexpr (!DENSE) {
+            std::size_t slot   = index_[routing_id];
+            index_[routing_id] = 0;
+            if (slot != count_) {
+                // 末尾の先頭を空いた位置へ移し、その索引を付け替える
+                heads_[slot]                           = heads_[count_];
+                index_[heads_[slot]->get_routing_id()] = static_cast<uint8_t>(slot);
+            }
+            heads_[count_--] = nullptr;
+        } else {
+            (void)routing_id;
+        }
+    }
+
+    std::array<Device*, HEAD_COUNT> heads_{};  // デバイスリストの先頭
+    std::array<uint8_t, ID_COUNT> ids_{};      // heads_ の各要素のルーティングID（線形探索）
+    std::array<uint8_t, INDEX_SIZE> index_{};  // ルーティングID → heads_ の位置（索引, 0 は未使用）
+    std::size_t count_ = 0;                    // 使用中の先頭の数（線形探索・索引）
+};
+
+}  // namespace detail
+}  // namespace gn10_can
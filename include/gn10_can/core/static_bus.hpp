@@ -0,0 +1,277 @@
+/**
+ * @file static_bus.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 接続するデバイスの型をコンパイル時に固定したバスクラス
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "gn10_can/core/acceptance_filter.hpp"
+#include "gn10_can/core/basic_device.hpp"
+#include "gn10_can/core/bus_interface.hpp"
+#include "gn10_can/core/frame_builder.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief 接続するデバイスの型をコンパイル時に固定したバスクラス
+ *
+ * ファームウェアのようにデバイス構成がビルド時に決まる場合に使います。
+ * 配送先は Devices... の並びから展開した比較の連鎖で決まり、仮想関数を経由せずに（型を指定して）
+ * 各デバイスへ渡します。コマンドテーブルを持つデバイスはテーブルの受信処理関数を関数ポインタで1回、
+ * 持たないデバイスは `on_receive()` を直接呼び出します。デバイスの受信統計も BasicBus と同じく数えます。
+ * デバイス配列・ルーティングテーブルを持たず、使用するRAMはデバイス数分のルーティングIDだけです。
+ *
+ * デバイスは BasicBus と同じクラスをそのまま使います。デバイスの生成後に bind() で登録してください。
+ * 送信キューは持たず、send_frame() はドライバーへ直接送信します（`TxQueueDepth = 0` の BasicBus と同じ）。
+ *
+ * @code
+ * StaticCANBus<MotorDriverServer, ServoMotorServer> bus(driver);
+ * MotorDriverServer motor(bus, 0);
+ * ServoMotorServer servo(bus, 1);
+ * bus.bind(motor, servo);
+ * @endcode
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ * @tparam Driver `send()` / `receive()` を持つドライバーの型
+ * @tparam Devices 接続するデバイスの型（BasicDevice<Frame> の派生クラス、同じ型を複数並べても良い）
+ */
+template <typename Frame, typename Driver, typename... Devices>
+class BasicStaticBus : public IBus<Frame>
+{
+public:
+    using FrameType  = Frame;
+    using DriverType = Driver;
+    using Device     = BasicDevice<Frame>;
+
+    using IBus<Frame>::send_frame;
+
+    static constexpr std::size_t MAX_DEVICES = sizeof...(Devices);  // 接続するデバイス数
+
+    static_assert(
+        (std::is_base_of_v<Device, Devices> && ...), "Devices must derive from BasicDevice<Frame>"
+    );
+
+    /**
+     * @brief バスクラスのコンストラクタ
+     *
+     * @param driver ドライバーの参照
+     */
+    explicit BasicStaticBus(Driver& driver) : driver_(driver)
+    {
+        routing_ids_.fill(UNBOUND_ROUTING_ID);
+    }
+
+    /**
+     * @brief デバイスを登録する
+     *
+     * Devices... と同じ順にデバイスを渡してください。登録したデバイスは破棄時に自動で解除されます。
+     *
+     * @param devices 登録するデバイス
+     */
+    void bind(Devices&... devices)
+    {
+        devices_ = std::tuple<Devices*...>(&devices...);
+        bind_routing_ids(std::index_sequence_for<Devices...>{});
+    }
+
+    /**
+     * @brief CANパケットの受信とデバイスへのルーティング処理
+     *
+     */
+    void update()
+    {
+        Frame frame;
+        while (driver_.receive(frame)) {
+            dispatch(frame, std::index_sequence_for<Devices...>{});
+        }
+        // 受信したデバイスの統計は BasicBus と同じく update() の終わりにまとめて公開する
+        publish_device_stats(std::index_sequence_for<Devices...>{});
+    }
+
+    /**
+     * @brief フレーム送信関数
+     *
+     * @param frame 送信するフレーム
+     * @param mode 送信キューでの扱い方（送信キューを持たないため無視する）
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    bool send_frame(const Frame& frame, TxMode mode) override
+    {
+        (void)mode;
+        return driver_.send(frame);
+    }
+
+    /**
+     * @brief 登録したデバイスだけを受信するハードウェア受信フィルタをドライバーに設定する
+     *
+     * bind() の後に呼び出してください。
+     *
+     * @return true 設定成功
+     * @return false ドライバーが受信フィルタに未対応、デバイスが未登録、または設定失敗
+     */
+    bool apply_acceptance_filters()
+    {
+        std::size_t max_filters = driver_.max_acceptance_filters();
+        if (max_filters > MAX_ACCEPTANCE_FILTERS) {
+            max_filters = MAX_ACCEPTANCE_FILTERS;
+        }
+        if (max_filters == 0) {
+            return false;
+        }
+
+        std::array<uint32_t, MAX_DEVICES> routing_ids{};
+        std::size_t id_count = 0;
+        for (uint32_t routing_id : routing_ids_) {
+            if (routing_id != UNBOUND_ROUTING_ID) {
+                routing_ids[id_count++] = routing_id;
+            }
+        }
+        std::array<AcceptanceFilter, MAX_ACCEPTANCE_FILTERS> filters{};
+        std::size_t count =
+            build_acceptance_filters(routing_ids.data(), id_count, filters.data(), max_filters);
+        if (count == 0) {
+            return false;  // デバイスが無いときに全フレームを破棄する設定にはしない
+        }
+        return driver_.set_acceptance_filters(filters.data(), count);
+    }
+
+private:
+    // どのフレームのルーティングID (最大26bit) とも一致しない値
+    static constexpr uint32_t UNBOUND_ROUTING_ID = 0xFFFFFFFF;
+
+    /**
+     * @brief デバイスの生成時に呼ばれる（登録は bind() で行うため何もしない）
+     *
+     */
+    bool attach(Device* device) override
+    {
+        return device != nullptr;
+    }
+
+    /**
+     * @brief デバイスの破棄時に呼ばれ、登録済みであれば解除する
+     *
+     * @param device 登録解除するデバイスへのポインタ
+     */
+    void detach(Device* device) override
+    {
+        unbind(device, std::index_sequence_for<Devices...>{});
+    }
+
+    /**
+     * @brief ビルダーが直接書き込む送信フレームの領域を確保する
+     *
+     * @return TxSlot<Frame> バスが持つ書き込み領域（全てビルダーが使用中の場合は空）
+     */
+    TxSlot<Frame> acquire_tx_slot() override
+    {
+        return tx_staging_.acquire();
+    }
+
+    /**
+     * @brief 書き込み領域のフレームを写さずにドライバーへ直接送信し、領域を返却する
+     *
+     * @param slot 書き込みを終えた領域
+     * @param mode 送信キューでの扱い方（送信キューを持たないため無視する）
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    bool commit_tx_slot(const TxSlot<Frame>& slot, TxMode mode) override
+    {
+        (void)mode;
+        bool sent = driver_.send(*slot.frame);
+        tx_staging_.release(slot);
+        return sent;
+    }
+
+    /**
+     * @brief 書き込み領域を送信せずに返却する
+     *
+     * @param slot 確保した領域
+     */
+    void cancel_tx_slot(const TxSlot<Frame>& slot) override
+    {
+        tx_staging_.release(slot);
+    }
+
+    template <std::size_t... I>
+    void bind_routing_ids(std::index_sequence<I...>)
+    {
+        ((routing_ids_[I] = std::get<I>(devices_)->get_routing_id()), ...);
+    }
+
+    template <std::size_t... I>
+    void unbind(Device* device, std::index_sequence<I...>)
+    {
+        (unbind_one<I>(device), ...);
+    }
+
+    template <std::size_t I>
+    void unbind_one(Device* device)
+    {
+        if (static_cast<Device*>(std::get<I>(devices_)) == device) {
+            routing_ids_[I] = UNBOUND_ROUTING_ID;
+        }
+    }
+
+    /**
+     * @brief 受信したフレームを、ルーティングIDが一致するデバイスへ登録順に配送する
+     *
+     * @param frame 受信フレーム
+     */
+    template <std::size_t... I>
+    void dispatch(const Frame& frame, std::index_sequence<I...>)
+    {
+        uint32_t routing_id = frame.get_routing_id();
+        uint8_t command     = static_cast<uint8_t>(frame.id & (Device::COMMAND_COUNT - 1));
+        (deliver<I>(routing_id, command, frame), ...);
+    }
+
+    template <std::size_t I>
+    void deliver(uint32_t routing_id, uint8_t command, const Frame& frame)
+    {
+        using DeviceType = std::tuple_element_t<I, std::tuple<Devices...>>;
+        if (routing_ids_[I] == routing_id) {
+            // 型を指定して渡し、仮想関数テーブルを経由しない（コマンドテーブルは関数ポインタで1回呼ぶ）
+            std::get<I>(devices_)->template deliver_as<DeviceType>(frame, command);
+        }
+    }
+
+    template <std::size_t... I>
+    void publish_device_stats(std::index_sequence<I...>)
+    {
+        (publish_device_stats_one<I>(), ...);
+    }
+
+    template <std::size_t I>
+    void publish_device_stats_one()
+    {
+        if (routing_ids_[I] == UNBOUND_ROUTING_ID) {
+            return;
+        }
+        Device* device = std::get<I>(devices_);
+        if (device->has_pending_stats()) {
+            device->publish_stats();
+        }
+    }
+
+    Driver& driver_;                                   // ドライバーの参照を保持
+    std::tuple<Devices*...> devices_{};                // bind() で登録したデバイス
+    std::array<uint32_t, MAX_DEVICES> routing_ids_{};  // 登録したデバイスのルーティングID
+    detail::TxStagingPool<Frame> tx_staging_;          // ビルダーが直接書き込む送信フレーム
+};
+
+}  // namespace gn10_can
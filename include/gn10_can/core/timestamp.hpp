@@ -0,0 +1,30 @@
+/**
+ * @file timestamp.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief バスで使う時刻(マイクロ秒)の型定義ヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_can {
+
+/**
+ * @brief マイクロ秒単位のタイムスタンプ（約71分で一周するため、差分で使用すること）
+ *
+ */
+using TimestampUs = uint32_t;
+
+/**
+ * @brief 現在時刻[us]を返す関数
+ *
+ * STM32 では DWT サイクルカウンタやタイマー、Linux では clock_gettime() を元に実装します。
+ */
+using TimeSourceUs = TimestampUs (*)();
+
+}  // namespace gn10_can
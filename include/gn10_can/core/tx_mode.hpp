@@ -0,0 +1,26 @@
+/**
+ * @file tx_mode.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 送信キューでのフレームの扱い方の定義ヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_can {
+
+/**
+ * @brief 送信キューでのフレームの扱い方
+ *
+ */
+enum class TxMode : uint8_t {
+    Deliver,   // 必ず届ける（Init, Gain など。送信待ちの同じIDがあっても別に積む）
+    Coalesce,  // 最新値のみ届ける（Target など。送信待ちの同じIDのフレームを上書きする）
+};
+
+}  // namespace gn10_can
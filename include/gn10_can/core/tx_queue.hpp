@@ -0,0 +1,276 @@
+/**
+ * @file tx_queue.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN IDの優先度順に並ぶソフトウェア送信キューのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/timestamp.hpp"
+#include "gn10_can/core/tx_mode.hpp"
+
+namespace gn10_can {
+
+/**
+ * @brief ソフトウェア送信キューの統計情報
+ *
+ */
+struct TxQueueStats {
+    uint32_t queued_frames    = 0;  // キューに積んだフレーム数（累計）
+    uint32_t dropped_frames   = 0;  // キュー満杯で破棄したフレーム数（累計）
+    uint32_t coalesced_frames = 0;  // 送信待ちの同じIDのフレームを上書きした回数（累計）
+    std::size_t depth         = 0;  // 現在キューに残っているフレーム数
+    std::size_t max_depth     = 0;  // キューに同時に残ったフレーム数の最大値
+    TimestampUs max_wait_us   = 0;  // キューで待たされた時間の最大値[us]
+    uint64_t total_wait_us    = 0;  // キューで待たされた時間の合計[us]（平均の算出用）
+};
+
+namespace detail {
+
+/**
+ * @brief フレームのバス調停での優先度キーを計算する（小さいほど優先）
+ *
+ * 同じベースIDでは標準IDが拡張IDに勝つ、というCANの調停規則を再現します。
+ *
+ * @tparam Frame フレームの型
+ * @param frame 対象のフレーム
+ * @return uint64_t 優先度キー
+ */
+template <typename Frame>
+uint64_t arbitration_key(const Frame& frame)
+{
+    constexpr uint32_t EXT_BITS = 18;  // 拡張IDのうちベースID(11bit)より下位のビット数
+    if (!frame.is_extended) {
+        return static_cast<uint64_t>(frame.id) << (EXT_BITS + 1);
+    }
+    uint64_t base = frame.id >> EXT_BITS;
+    uint64_t ext  = frame.id & ((uint32_t{1} << EXT_BITS) - 1);
+    return (base << (EXT_BITS + 1)) | (uint64_t{1} << EXT_BITS) | ext;
+}
+
+/**
+ * @brief CAN IDの優先度順に並ぶ固定長の送信キュー（整列済み配列）
+ *
+ * ハードウェアの送信メールボックス・FIFOが満杯のときにフレームを一時的に保持します。
+ * フレームは優先度順に連続して並ぶため、先頭からそのまま send_batch() へ渡せます。
+ * 同じ優先度のフレームは積んだ順に取り出されます。動的メモリは使用しません。
+ *
+ * @tparam Frame フレームの型
+ * @tparam Depth キューの段数
+ */
+template <typename Frame, std::size_t Depth>
+class TxQueue
+{
+public:
+    /**
+     * @brief 先頭の要素の参照
+     *
+     */
+    struct Head {
+        const Frame& frame;     // 送信するフレーム
+        TimestampUs queued_us;  // キューに積んだ時刻
+    };
+
+    /**
+     * @brief フレームをキューに積む
+     *
+     * mode が Coalesce で、同じIDの Coalesce なフレームが送信待ちの場合は、その位置のまま
+     * 中身だけを上書きします（キューでの順番と待ち時間の起点は引き継ぎます）。
+     *
+     * 満杯の場合は、キュー内で最も優先度の低い Coalesce なフレームより新しいフレームの方が
+     * 優先度が高ければ入れ替え、そうでなければ新しいフレームを破棄します。Deliver のフレームは
+     * 送信成功として受け付け済みのため追い出しません。いずれも破棄数に計上されます。
+     *
+     * @param frame 積むフレーム
+     * @param now_us 現在時刻
+     * @param mode フレームの扱い方
+     * @return true 積んだ（上書きを含む）
+     * @return false 破棄した
+     */
+    bool push(const Frame& frame, TimestampUs now_us, TxMode mode = TxMode::Deliver)
+    {
+        bool coalesce = (mode == TxMode::Coalesce);
+        if (coalesce) {
+            for (std::size_t i = 0; i < size_; i++) {
+                if (entries_[i].coalesce && frames_[i].id == frame.id &&
+                    frames_[i].is_extended == frame.is_extended) {
+                    frames_[i] = frame;
+                    stats_.coalesced_frames++;
+                    return true;
+                }
+            }
+        }
+
+        Entry entry{arbitration_key(frame), now_us, coalesce};
+
+        if (size_ >= Depth) {
+            stats_.dropped_frames++;
+            std::size_t lowest = find_evictable();
+            // 同じ優先度では先に積んだ方が先に送信されるため、追い出すのは新しい方が勝つ場合だけ
+            if (lowest >= size_ || entry.key >= entries_[lowest].key) {
+                return false;
+            }
+            remove_at(lowest);
+        }
+        insert(frame, entry);
+
+        stats_.queued_frames++;
+        if (size_ > stats_.max_depth) {
+            stats_.max_depth = size_;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 最も優先度の高い要素を参照する（空でないこと）
+     *
+     * @return Head 先頭の要素
+     */
+    Head top() const
+    {
+        return Head{frames_[0], entries_[0].queued_us};
+    }
+
+    /**
+     * @brief 優先度順に並んだ送信待ちのフレームを参照する
+     *
+     * 先頭から size() 個のフレームが連続して並びます。
+     *
+     * @return const Frame* 最も優先度の高いフレーム
+     */
+    const Frame* frames() const
+    {
+        return frames_.data();
+    }
+
+    /**
+     * @brief 優先度の高い順に要素を取り除き、待ち時間を統計に反映する
+     *
+     * @param now_us 現在時刻
+     * @param count 取り除く要素数（size() 以下）
+     */
+    void pop(TimestampUs now_us, std::size_t count = 1)
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            TimestampUs wait_us = now_us - entries_[i].queued_us;
+            stats_.total_wait_us += wait_us;
+            if (wait_us > stats_.max_wait_us) {
+                stats_.max_wait_us = wait_us;
+            }
+        }
+
+        for (std::size_t i = count; i < size_; i++) {
+            frames_[i - count]  = frames_[i];
+            entries_[i - count] = entries_[i];
+        }
+        size_ -= count;
+    }
+
+    /**
+     * @brief キューが空かどうか
+     *
+     * @return true 空
+     * @return false フレームが残っている
+     */
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief キューに残っているフレーム数
+     *
+     * @return std::size_t フレーム数
+     */
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief 統計情報を取得する
+     *
+     * @return TxQueueStats 統計情報
+     */
+    TxQueueStats stats() const
+    {
+        TxQueueStats result = stats_;
+        result.depth        = size_;
+        return result;
+    }
+
+private:
+    /**
+     * @brief フレーム以外の要素の情報
+     *
+     */
+    struct Entry {
+        uint64_t key          = 0;      // 調停の優先度キー
+        TimestampUs queued_us = 0;      // キューに積んだ時刻
+        bool coalesce         = false;  // 同じIDの新しいフレームで上書きしてよいか
+    };
+
+    /**
+     * @brief 追い出してよい要素 (Coalesce) のうち、最も優先度の低いものの位置を探す
+     *
+     * @return std::size_t 要素の位置（追い出せる要素がない場合は size_）
+     */
+    std::size_t find_evictable() const
+    {
+        for (std::size_t i = size_; i > 0; i--) {
+            if (entries_[i - 1].coalesce) {
+                return i - 1;
+            }
+        }
+        return size_;
+    }
+
+    /**
+     * @brief 同じ優先度の要素の後ろに挿入する（空きがあること）
+     *
+     * @param frame 挿入するフレーム
+     * @param entry 挿入する要素の情報
+     */
+    void insert(const Frame& frame, const Entry& entry)
+    {
+        std::size_t index = size_;
+        while (index > 0 && entry.key < entries_[index - 1].key) {
+            frames_[index]  = frames_[index - 1];
+            entries_[index] = entries_[index - 1];
+            index--;
+        }
+        frames_[index]  = frame;
+        entries_[index] = entry;
+        size_++;
+    }
+
+    /**
+     * @brief 要素を取り除き、後ろの要素を詰める
+     *
+     * @param index 取り除く要素の位置
+     */
+    void remove_at(std::size_t index)
+    {
+        for (std::size_t i = index + 1; i < size_; i++) {
+            frames_[i - 1]  = frames_[i];
+            entries_[i - 1] = entries_[i];
+        }
+        size_--;
+    }
+
+    std::array<Frame, Depth> frames_{};   // 送信待ちのフレーム（優先度順）
+    std::array<Entry, Depth> entries_{};  // frames_ と同じ位置の要素の情報
+    std::size_t size_ = 0;                // 要素数
+    TxQueueStats stats_{};                // 統計情報
+};
+
+}  // namespace detail
+}  // namespace gn10_can
@@ -10,12 +10,13 @@
  */
 #pragma once
 
-#include <optional>
+#include <cstdint>
 
 #include "gn10_can/core/fdcan_bus.hpp"
 #include "gn10_can/core/fdcan_device.hpp"
 #include "gn10_can/core/fdcan_frame.hpp"
 #include "gn10_can/devices/esc_hub_config.hpp"
+#include "gn10_can/utils/seqlock.hpp"
 
 namespace gn10_can {
 namespace devices {
@@ -27,26 +28,38 @@ public:
      * @brief ESCHubClientのコンストラクタ
      * @details CANbusの登録とdevice_idの割り振りを行う
      */
-    ESCHubClient(FDCANBus& bus, uint8_t device_id);
+    ESCHubClient(IFDCANBus& bus, uint8_t device_id);
 
     /**
      * @brief ゲインを格納する関数。
      *
      * @param motor_num ゲインを設定したいモーター (0〜3)
      * @param all_gain ゲインを格納する配列 kp ki kd ffの順で格納します
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_gain_all(const ESCHubConfig& esc_hub_config);
+    bool set_gain_all(const ESCHubConfig& esc_hub_config);
 
     /**
      * @brief　角速度を設定する変数
      *
+     * 送信待ちの同じコマンドがあれば最新値で上書きされます（古い値は送信されません）。
+     *
      * @param angular_velocities ４つ分のモーターの角速度の配列
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_angular_velocities(float angular_velocities[4]);
+    bool set_angular_velocities(float angular_velocities[4]);
 
     /**
      * @brief 角速度を受け取る関数
      *
+     * 前回受け取ってから新しいフィードバックを受信した場合だけ、最新の値を返します。
+     * 受信スレッドと別のスレッドから呼んでも、4つの角速度は同じフレームの組で返ります。
+     * 呼び出すスレッドは1つにしてください。
+     *
      * @param angular_velocity_feedbacks フィードバックで受け取った角速度
      * @return true すべての角速度を受け取ることができた
      * @return false すべての角速度を受け取ることができなかった。
@@ -54,17 +67,31 @@ public:
     bool get_angular_velocity_feedbacks(float angular_velocity_feedbacks[4]);
 
     /**
-     * @brief データをprivate関数に格納してあげる関数
+     * @brief 角速度と、そのフレームの受信時刻を受け取る関数
+     *
+     * @param angular_velocity_feedbacks フィードバックで受け取った角速度
+     * @param received_at_us 受信時刻[us]の格納先（タイムスタンプ無効時は0）
+     * @return true すべての角速度を受け取ることができた
+     * @return false すべての角速度を受け取ることができなかった。
      */
-    void on_receive(const FDCANFrame& frame) override;
+    bool get_angular_velocity_feedbacks(
+        float angular_velocity_feedbacks[4], TimestampUs& received_at_us
+    );
 
 private:
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_angular_velocities_feedbacks(const FDCANFrame& frame);
+
     // 角速度格納用構造体
     struct AngularVelocityFeedbacks {
         float angular_velocity_feedback[4];
+        TimestampUs received_at_us;  // 受信時刻[us]
+        uint32_t received_count;     // 受信したフィードバックの数（0は未受信）
     };
 
-    std::optional<AngularVelocityFeedbacks> angular_velocity_feedback_;
+    utils::SeqLock<AngularVelocityFeedbacks> angular_velocity_feedback_;  // 受信スレッドが更新する角速度
+    uint32_t read_count_ = 0;                                             // 前回受け取った received_count
 };
 
 }  // namespace devices
@@ -17,7 +17,7 @@ public:
      * @brief ESCHubServerのコンストラクタ
      * @details CANbusの登録とdevice_idの割り振りを行う
      */
-    ESCHubServer(FDCANBus& bus, uint8_t device_id);
+    ESCHubServer(IFDCANBus& bus, uint8_t device_id);
 
     /**
      * @brief ゲインを読み取る関数。init
@@ -36,12 +36,12 @@ public:
      */
     bool get_angular_velocities(float angular_velocities[4]);
 
-    /**
-     * @brief データをprivate関数に格納してあげる関数
-     */
-    void on_receive(const FDCANFrame& frame) override;
-
 private:
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_gain(const FDCANFrame& frame);
+    void handle_angular_velocities(const FDCANFrame& frame);
+
     // 角速度格納用構造体
     struct AngularVelocities {
         float angular_velocity[4];
@@ -14,6 +14,7 @@
 
 #include "gn10_can/core/can_device.hpp"
 #include "gn10_can/devices/motor_driver_types.hpp"
+#include "gn10_can/utils/seqlock.hpp"
 
 namespace gn10_can {
 namespace devices {
@@ -31,36 +32,60 @@ public:
      * @param bus CANBusクラスの参照
      * @param dev_id デバイスID
      */
-    MotorDriverClient(CANBus& bus, uint8_t dev_id);
+    MotorDriverClient(ICANBus& bus, uint8_t dev_id);
 
     /**
      * @brief モータードライバー初期化コマンド送信関数
      *
      * @param config モータードライバー設定データ
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_init(const MotorConfig& config);
+    bool set_init(const MotorConfig& config);
 
     /**
      * @brief モータードライバー目標値コマンド送信関数
      *
+     * 送信待ちの目標値があれば最新値で上書きされます（古い目標値は送信されません）。
+     *
      * @param target 目標値（速度制御の場合は速度、位置制御の場合は位置）
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_target(float target);
+    bool set_target(float target);
 
     /**
      * @brief モータードライバーゲイン設定コマンド送信関数
      *
      * @param type ゲインの種類
      * @param value ゲイン値
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
+     */
+    bool set_gain(devices::GainType type, float value);
+
+    /**
+     * @brief 最新のフィードバックを取得する
+     *
+     * 受信スレッドと別のスレッドから呼んでも、値とリミットスイッチ状態は同じフレームの組で返ります。
+     * received_at_us はそのフレームの受信時刻で、値の古さや制御遅延の計算に使えます。
+     *
+     * @return MotorFeedback フィードバック
      */
-    void set_gain(devices::GainType type, float value);
+    MotorFeedback feedback() const;
 
     /**
-     * @brief CANパケット受信時の呼び出し関数の実装
+     * @brief 最新のモータードライバー状態を取得する
      *
-     * @param frame 受信したCANパケット
+     * 受信スレッドと別のスレッドから呼んでも、電流と温度は同じフレームの組で返ります。
+     * received_at_us はそのフレームの受信時刻です。
+     *
+     * @return MotorHardwareStatus モータードライバー状態
      */
-    void on_receive(const CANFrame& frame) override;
+    MotorHardwareStatus hardware_status() const;
 
     /**
      * @brief 最新のフィードバック値を取得する
@@ -90,10 +115,13 @@ public:
     int8_t temperature() const;
 
 private:
-    float feedback_value_{0.0f};
-    uint8_t limit_switches_{0};
-    float load_current_{0.0f};
-    int8_t temperature_{0};
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_feedback(const CANFrame& frame);
+    void handle_hardware_status(const CANFrame& frame);
+
+    utils::SeqLock<MotorFeedback> feedback_;               // 受信スレッドが更新するフィードバック
+    utils::SeqLock<MotorHardwareStatus> hardware_status_;  // 受信スレッドが更新する状態
 };
 }  // namespace devices
 }  // namespace gn10_can
@@ -31,23 +31,29 @@ public:
      * @param bus CANBusクラスの参照
      * @param dev_id デバイスID
      */
-    MotorDriverServer(CANBus& bus, uint8_t dev_id);
+    MotorDriverServer(ICANBus& bus, uint8_t dev_id);
 
     /**
      * @brief モータードライバーフィードバック送信関数
      *
      * @param feedback_val 現在値（速度制御の場合は速度、位置制御の場合は位置）
      * @param limit_switch_state リミットスイッチ状態（ビットマップ形式）
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void send_feedback(float feedback_val, uint8_t limit_switch_state);
+    bool send_feedback(float feedback_val, uint8_t limit_switch_state);
 
     /**
      * @brief モータードライバー状態送信関数
      *
      * @param load_current 電流
      * @param temperature 温度
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void send_hardware_status(float load_current, int8_t temperature);
+    bool send_hardware_status(float load_current, int8_t temperature);
 
     /**
      * @brief 新しい設定があれば更新する
@@ -77,14 +83,13 @@ public:
      */
     bool get_new_gain(GainType type, float& value);
 
-    /**
-     * @brief CANパケット受信時の呼び出し関数の実装
-     *
-     * @param frame 受信したCANパケット
-     */
-    void on_receive(const CANFrame& frame) override;
-
 private:
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_init(const CANFrame& frame);
+    void handle_target(const CANFrame& frame);
+    void handle_gain(const CANFrame& frame);
+
     static constexpr std::size_t kGainTypeCount = static_cast<std::size_t>(GainType::Count);
 
     std::optional<MotorConfig> config_;
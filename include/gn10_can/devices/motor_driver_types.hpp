@@ -15,6 +15,8 @@
 #include <cstdint>
 #include <cstring>
 
+#include "gn10_can/core/timestamp.hpp"
+
 namespace gn10_can {
 namespace devices {
 
@@ -39,6 +41,24 @@ enum class GainType : uint8_t {
     Count = 0x04   ///< @brief ゲインタイプの総数
 };
 
+/**
+ * @brief モータードライバーのフィードバック（同時に受信した値の組）
+ */
+struct MotorFeedback {
+    float value                = 0.0f;  ///< @brief 現在値（速度制御の場合は速度、位置制御の場合は位置）
+    uint8_t limit_switches     = 0;     ///< @brief リミットスイッチ状態（ビットマップ形式）
+    TimestampUs received_at_us = 0;     ///< @brief 受信時刻[us]（タイムスタンプ無効時は0）
+};
+
+/**
+ * @brief モータードライバーの状態（同時に受信した値の組）
+ */
+struct MotorHardwareStatus {
+    float load_current         = 0.0f;  ///< @brief 負荷電流
+    int8_t temperature         = 0;     ///< @brief 温度
+    TimestampUs received_at_us = 0;     ///< @brief 受信時刻[us]（タイムスタンプ無効時は0）
+};
+
 /**
  * @brief モータードライバーの設定データを管理するクラス
  */
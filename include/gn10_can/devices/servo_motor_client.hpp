@@ -19,21 +19,28 @@ namespace devices {
 class ServoMotorClient : public CANDevice
 {
 public:
-    ServoMotorClient(CANBus& bus, uint8_t device_id);
+    ServoMotorClient(ICANBus& bus, uint8_t device_id);
     /**
      * @brief サーボモータのパルス幅最大値と最小値の設定
      *
      * @param min_us　パルス幅最大値
      * @param max_us　パルス幅最小値
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_init(uint16_t min_us, uint16_t max_us);
+    bool set_init(uint16_t min_us, uint16_t max_us);
     /**
      * @brief　サーボモータで指定したい角度の設定
      *
+     * 送信待ちの同じコマンドがあれば最新値で上書きされます（古い値は送信されません）。
+     *
      * @param angle_rad サーボモータの角度
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_angle_rad(float angle_rad);
-    void on_receive(const CANFrame& frame) override;
+    bool set_angle_rad(float angle_rad);
 };
 }  // namespace devices
 }  // namespace gn10_can
\ No newline at end of file
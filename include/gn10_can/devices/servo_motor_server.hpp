@@ -11,7 +11,7 @@ namespace devices {
 class ServoMotorServer : public CANDevice
 {
 public:
-    ServoMotorServer(CANBus& bus, uint8_t device_id);
+    ServoMotorServer(ICANBus& bus, uint8_t device_id);
     /**
      * @brief 受け取ったパルス幅の最大値と最小値の設定
      *
@@ -29,9 +29,13 @@ public:
      * @return false
      */
     bool get_new_angle_rad(float& angle_rad);
-    void on_receive(const CANFrame& frame) override;
 
 private:
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_init(const CANFrame& frame);
+    void handle_angle_rad(const CANFrame& frame);
+
     struct PulseSet {
         uint16_t min_us;
         uint16_t max_us;
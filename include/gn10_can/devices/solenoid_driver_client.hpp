@@ -26,30 +26,37 @@ public:
      * @param bus CANBusクラスの参照
      * @param dev_id デバイスID
      */
-    SolenoidDriverClient(CANBus& bus, uint8_t dev_id);
+    SolenoidDriverClient(ICANBus& bus, uint8_t dev_id);
 
     /**
      * @brief モータードライバー初期化コマンド送信関数
      *
      * @param config モータードライバー設定データ
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_init();
+    bool set_init();
 
     /**
      * @brief ソレノイドドライバー目標値コマンド送信関数
      *
      * @param target 目標値(8bit)
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_target(const uint8_t& target);
+    bool set_target(const uint8_t& target);
 
     /**
      * @brief ソレノイドドライバー目標値コマンド送信関数
      *
      * @param target 目標値(配列)
+     *
+     * @return true 送信成功（送信キューへの投入を含む）
+     * @return false 送信失敗
      */
-    void set_target(const std::array<bool, 8>& target);
-
-    void on_receive(const CANFrame& frame) override;
+    bool set_target(const std::array<bool, 8>& target);
 
 private:
 };
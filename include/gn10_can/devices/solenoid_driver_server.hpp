@@ -27,7 +27,7 @@ public:
      * @param bus CANBusクラスの参照
      * @param dev_id デバイスID
      */
-    SolenoidDriverServer(CANBus& bus, uint8_t dev_id);
+    SolenoidDriverServer(ICANBus& bus, uint8_t dev_id);
 
     /**
      * @brief 新しい設定があれば更新する
@@ -56,14 +56,12 @@ public:
      */
     bool get_new_target(std::array<bool, 8>& target);
 
-    /**
-     * @brief CANパケット受信時の呼び出し関数の実装
-     *
-     * @param frame 受信したCANパケット
-     */
-    void on_receive(const CANFrame& frame) override;
-
 private:
+    static const CommandTable COMMAND_TABLE;  // コマンドごとの受信処理関数
+
+    void handle_init(const CANFrame& frame);
+    void handle_target(const CANFrame& frame);
+
     std::optional<uint8_t> init_;
     std::optional<uint8_t> target_;
 };
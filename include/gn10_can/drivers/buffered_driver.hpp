@@ -0,0 +1,306 @@
+/**
+ * @file buffered_driver.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 受信割り込みでフレームをリングバッファに溜め、メインループで取り出すドライバーアダプタ
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "gn10_can/core/timestamp.hpp"
+#include "gn10_can/drivers/can_driver_interface.hpp"
+#include "gn10_can/drivers/fdcan_driver_interface.hpp"
+#include "gn10_can/utils/spsc_ring_buffer.hpp"
+
+namespace gn10_can {
+namespace drivers {
+
+/**
+ * @brief 受信割り込みとメインループの間に SPSC リングバッファを挟むドライバーアダプタ
+ *
+ * 受信割り込みから on_rx_interrupt() を呼ぶと、ハードウェアFIFOのフレームを全てリングへ移します。
+ * バスの update() はメインループからリングを読み出すため、
+ * ポーリングが遅れてもハードウェアFIFO (bxCANは3段) が溢れにくくなります。
+ * バスはリングのスロット上のフレームを直接デバイスへ配送するため (peek_receive())、
+ * リングから取り出す際のフレームのコピーは発生しません。
+ * 送信はそのまま内側のドライバーへ委譲します。
+ *
+ * `GN10_CAN_ENABLE_TIMESTAMP` が有効で set_time_source() を設定した場合、内側のドライバーが
+ * 受信時刻を設定しなかったフレームには、リングへ積む時点（割り込み内）の時刻を設定します。
+ * メインループで読み出す時刻ではないため、ポーリングの遅れが受信時刻に混ざりません。
+ *
+ * @tparam Frame 扱うフレームの型
+ * @tparam Interface 実装するドライバーインターフェース (ICANDriver / IFDCANDriver)
+ * @tparam Depth リングバッファの段数（2のべき乗）
+ */
+template <typename Frame, typename Interface, std::size_t Depth>
+class BasicBufferedDriver : public Interface
+{
+public:
+    static constexpr std::size_t DEPTH = Depth;
+
+    /**
+     * @brief コンストラクタ
+     *
+     * @param inner ハードウェアにアクセスする内側のドライバー
+     */
+    explicit BasicBufferedDriver(Interface& inner) : inner_(inner) {}
+
+    /**
+     * @brief 受信時刻の取得元を設定する（受信割り込みを有効にする前に呼ぶ）
+     *
+     * 割り込みから呼ばれるため、取得元は割り込み内で呼び出せる関数にしてください。
+     * タイムスタンプが無効な場合は使用されません。
+     *
+     * @param time_source 現在時刻[us]を返す関数（nullptr の場合は設定しない）
+     */
+    void set_time_source(TimeSourceUs time_source)
+    {
+        time_source_ = time_source;
+    }
+
+    /**
+     * @brief 受信割り込みから呼ぶ関数。内側のドライバーの受信フレームを全てリングへ移す
+     *
+     * リングが満杯の場合もハードウェアFIFOは読み捨て、overflow_count() に計上します。
+     *
+     * @return std::size_t リングへ積んだフレーム数
+     */
+    std::size_t on_rx_interrupt()
+    {
+        std::size_t pushed = 0;
+        Frame frame;
+        frame.set_timestamp(0);
+        while (inner_.receive(frame)) {
+            stamp(frame);
+            if (push(frame)) {
+                pushed++;
+            }
+            frame.set_timestamp(0);  // 次のフレームで前の受信時刻を引き継がない
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief 割り込み側で読み出したフレームをリングへ積む関数
+     *
+     * HALのコールバック内で自らフレームを読み出す場合に使用します。
+     *
+     * @param frame 受信フレーム
+     * @return true 積んだ
+     * @return false リングが満杯で破棄した
+     */
+    bool push_from_isr(const Frame& frame)
+    {
+        if constexpr (Frame::HAS_TIMESTAMP) {
+            if (frame.timestamp() == 0 && time_source_ != nullptr) {
+                Frame stamped = frame;
+                stamped.set_timestamp(time_source_());
+                return push(stamped);
+            }
+        }
+        return push(frame);
+    }
+
+    /**
+     * @brief フレーム送信関数（内側のドライバーへ委譲）
+     *
+     * @param frame 送信するフレーム
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    bool send(const Frame& frame) override
+    {
+        return inner_.send(frame);
+    }
+
+    /**
+     * @brief フレーム受信関数（リングから取り出す）
+     *
+     * @param out_frame 受信したフレームの格納先
+     * @return true 受信成功
+     * @return false リングが空
+     */
+    bool receive(Frame& out_frame) override
+    {
+        return ring_.try_pop(out_frame);
+    }
+
+    /**
+     * @brief 複数フレームをまとめて送信する関数（内側のドライバーへ委譲）
+     *
+     * @param frames 送信するフレームの配列
+     * @param count 送信するフレーム数
+     * @return std::size_t 送信できたフレーム数
+     */
+    std::size_t send_batch(const Frame* frames, std::size_t count) override
+    {
+        return inner_.send_batch(frames, count);
+    }
+
+    /**
+     * @brief 複数フレームをまとめて受信する関数（リングから取り出す）
+     *
+     * @param out_frames 受信したフレームの格納先
+     * @param max_frames 受信する最大フレーム数
+     * @return std::size_t 受信したフレーム数
+     */
+    std::size_t receive_batch(Frame* out_frames, std::size_t max_frames) override
+    {
+        std::size_t received = 0;
+        while (received < max_frames && ring_.try_pop(out_frames[received])) {
+            received++;
+        }
+        return received;
+    }
+
+    /**
+     * @brief リングの受信フレームをコピーせずに参照する関数
+     *
+     * バスはリングのスロット上のフレームをそのままデバイスへ配送し、配送後に release_receive()
+     * で取り除きます。その間、割り込み側はこれらのスロットに書き込みません。
+     *
+     * @param out_frames 先頭の受信フレームを指すポインタの格納先
+     * @return std::size_t 先頭から連続して参照できるフレーム数（リングが空の場合は0）
+     */
+    std::size_t peek_receive(Frame*& out_frames) override
+    {
+        return ring_.peek(out_frames);
+    }
+
+    /**
+     * @brief peek_receive() で参照したフレームをリングから取り除く関数
+     *
+     * @param count 取り除くフレーム数
+     */
+    void release_receive(std::size_t count) override
+    {
+        ring_.pop(count);
+    }
+
+    /**
+     * @brief ハードウェアに設定できる受信フィルタ数を取得する（内側のドライバーへ委譲）
+     *
+     * @return std::size_t フィルタ数
+     */
+    std::size_t max_acceptance_filters() const override
+    {
+        return inner_.max_acceptance_filters();
+    }
+
+    /**
+     * @brief ハードウェアの受信フィルタを設定する（内側のドライバーへ委譲）
+     *
+     * @param filters 受信フィルタの配列
+     * @param count フィルタ数
+     * @return true 設定成功
+     * @return false 設定失敗、または未対応
+     */
+    bool set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count) override
+    {
+        return inner_.set_acceptance_filters(filters, count);
+    }
+
+    /**
+     * @brief リングが満杯で破棄したフレーム数を取得する
+     *
+     * @return uint32_t 破棄したフレーム数
+     */
+    uint32_t overflow_count() const
+    {
+        return overflow_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief リングに同時に溜まったフレーム数の最大値を取得する
+     *
+     * Depth の見積もりに使用します。
+     *
+     * @return std::size_t 最大滞留フレーム数
+     */
+    std::size_t high_water_mark() const
+    {
+        return high_water_mark_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 現在リングに溜まっているフレーム数を取得する
+     *
+     * @return std::size_t 滞留フレーム数
+     */
+    std::size_t pending() const
+    {
+        return ring_.size();
+    }
+
+private:
+    /**
+     * @brief 受信時刻が未設定のフレームに現在時刻を設定する
+     *
+     * @param frame 受信フレーム
+     */
+    void stamp(Frame& frame) const
+    {
+        if constexpr (Frame::HAS_TIMESTAMP) {
+            if (frame.timestamp() == 0 && time_source_ != nullptr) {
+                frame.set_timestamp(time_source_());
+            }
+        } else {
+            (void)frame;
+        }
+    }
+
+    /**
+     * @brief フレームをリングへ積み、滞留数の最大値を更新する
+     *
+     * @param frame 受信フレーム
+     * @return true 積んだ
+     * @return false リングが満杯で破棄した
+     */
+    bool push(const Frame& frame)
+    {
+        if (!ring_.try_push(frame)) {
+            overflow_count_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // 生産者側だけが書き込むので load → store で十分
+        std::size_t level = ring_.size();
+        if (level > high_water_mark_.load(std::memory_order_relaxed)) {
+            high_water_mark_.store(level, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    Interface& inner_;                             // ハードウェアにアクセスする内側のドライバー
+    utils::SPSCRingBuffer<Frame, Depth> ring_;     // 割り込み → メインループの受信リング
+    std::atomic<uint32_t> overflow_count_{0};      // リング満杯で破棄したフレーム数
+    std::atomic<std::size_t> high_water_mark_{0};  // 最大滞留フレーム数
+    TimeSourceUs time_source_ = nullptr;           // 受信時刻の取得元
+};
+
+/**
+ * @brief CAN用の受信バッファ付きドライバー
+ *
+ * @tparam Depth リングバッファの段数（2のべき乗）
+ */
+template <std::size_t Depth>
+using BufferedCANDriver = BasicBufferedDriver<CANFrame, ICANDriver, Depth>;
+
+/**
+ * @brief FDCAN用の受信バッファ付きドライバー
+ *
+ * @tparam Depth リングバッファの段数（2のべき乗）
+ */
+template <std::size_t Depth>
+using BufferedFDCANDriver = BasicBufferedDriver<FDCANFrame, IFDCANDriver, Depth>;
+
+}  // namespace drivers
+}  // namespace gn10_can
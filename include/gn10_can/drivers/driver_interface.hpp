@@ -0,0 +1,163 @@
+/**
+ * @file driver_interface.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN通信ハードウェアインターフェースの抽象化クラスのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-01-10
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "gn10_can/core/acceptance_filter.hpp"
+
+namespace gn10_can {
+namespace drivers {
+
+/**
+ * @brief CAN通信ハードウェアインターフェースの抽象化クラス
+ *
+ * 従来のCANとCAN FDで、扱うフレームの型だけが異なります。
+ * ドライバーは ICANDriver / IFDCANDriver のいずれかを実装してください。
+ *
+ * @tparam Frame 扱うフレームの型 (CANFrame / FDCANFrame)
+ */
+template <typename Frame>
+class BasicDriver
+{
+public:
+    virtual ~BasicDriver() = default;
+
+    /**
+     * @brief フレーム送信関数
+     *
+     * @param frame 送信するフレーム
+     * @return true 送信成功
+     * @return false 送信失敗
+     */
+    virtual bool send(const Frame& frame) = 0;
+
+    /**
+     * @brief フレーム受信関数
+     *
+     * @param out_frame 受信したフレームの格納先
+     * @return true 受信成功
+     * @return false 受信失敗（受信データなしなど）
+     */
+    virtual bool receive(Frame& out_frame) = 0;
+
+    /**
+     * @brief 複数フレームをまとめて送信する関数
+     *
+     * 既定の実装は send() を1フレームずつ呼び出し、失敗した時点で止めます。
+     * SocketCAN の sendmmsg() のようにまとめて書き込めるドライバーはオーバーライドしてください。
+     *
+     * @param frames 送信するフレームの配列
+     * @param count 送信するフレーム数
+     * @return std::size_t 送信できたフレーム数（先頭から連続）
+     */
+    virtual std::size_t send_batch(const Frame* frames, std::size_t count)
+    {
+        std::size_t sent = 0;
+        while (sent < count && send(frames[sent])) {
+            sent++;
+        }
+        return sent;
+    }
+
+    /**
+     * @brief 複数フレームをまとめて受信する関数
+     *
+     * 既定の実装は receive() を受信データがなくなるか max_frames に達するまで呼び出します。
+     * 受信キューから一度に読み出せるドライバーはオーバーライドすると、
+     * フレームごとの仮想関数呼び出しを省けます。
+     *
+     * @param out_frames 受信したフレームの格納先（max_frames 個以上の領域）
+     * @param max_frames 受信する最大フレーム数
+     * @return std::size_t 受信したフレーム数
+     */
+    virtual std::size_t receive_batch(Frame* out_frames, std::size_t max_frames)
+    {
+        std::size_t received = 0;
+        while (received < max_frames && receive(out_frames[received])) {
+            received++;
+        }
+        return received;
+    }
+
+    /**
+     * @brief 受信フレームを、コピーせずドライバーの受信バッファ上で参照する関数
+     *
+     * 受信フレームを自身のバッファ（割り込みで積むリングバッファなど）に保持するドライバーが
+     * オーバーライドすると、バスは receive_batch() でのコピーを省き、バッファ上のフレームを
+     * そのままデバイスへ配送します。参照させたフレームは release_receive() まで取り除かず、
+     * 書き換えないでください（受信時刻の設定のため、バスが書き込むことがあります）。
+     * 既定の実装は未対応として0を返します。
+     *
+     * @param out_frames 先頭の受信フレームを指すポインタの格納先
+     * @return std::size_t 先頭から連続して参照できるフレーム数（受信データなし、または未対応の場合は0）
+     */
+    virtual std::size_t peek_receive(Frame*& out_frames)
+    {
+        out_frames = nullptr;
+        return 0;
+    }
+
+    /**
+     * @brief peek_receive() で参照した受信フレームを先頭から取り除く関数
+     *
+     * @param count 取り除くフレーム数（直前の peek_receive() の戻り値以下）
+     */
+    virtual void release_receive(std::size_t count)
+    {
+        (void)count;
+    }
+
+    /**
+     * @brief ハードウェアに設定できる受信フィルタ数を取得する
+     *
+     * @return std::size_t フィルタ数（0の場合は受信フィルタの設定に未対応）
+     */
+    virtual std::size_t max_acceptance_filters() const
+    {
+        return 0;
+    }
+
+    /**
+     * @brief ハードウェアの受信フィルタを設定する
+     *
+     * 設定後は、いずれかのフィルタに一致する標準IDのフレームだけを受信します。
+     * count が 0 の場合は何も受信できなくなるため、設定を変えずに false を返してください。
+     * 既定の実装は未対応として false を返します。
+     *
+     * @param filters 受信フィルタの配列
+     * @param count フィルタ数（1 以上、max_acceptance_filters() 以下）
+     * @return true 設定成功
+     * @return false 設定失敗、count が範囲外、または未対応
+     */
+    virtual bool set_acceptance_filters(const AcceptanceFilter* filters, std::size_t count)
+    {
+        (void)filters;
+        (void)count;
+        return false;
+    }
+
+    /**
+     * @brief 受信・送信の準備ができたことを poll / epoll で待てるファイルディスクリプタを取得する
+     *
+     * 受信フレームがあるとき読み込み可能、送信できるとき書き込み可能になるディスクリプタ
+     * (SocketCAN のソケットなど) を返します。EventLoop がこれを待つことで、
+     * update() を空回りさせずに済みます。既定の実装は未対応として -1 を返します。
+     *
+     * @return int ファイルディスクリプタ（未対応の場合は -1）
+     */
+    virtual int event_fd() const
+    {
+        return -1;
+    }
+};
+}  // namespace drivers
+}  // namespace gn10_can
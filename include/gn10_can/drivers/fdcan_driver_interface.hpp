@@ -1,7 +1,7 @@
 /**
- * @file driver_interface.hpp
+ * @file fdcan_driver_interface.hpp
  * @author Gento Aiba (aiba-gento)
- * @brief CAN通信ハードウェアインターフェースの抽象化クラスのヘッダーファイル
+ * @brief CAN FD通信ハードウェアインターフェースのヘッダーファイル
  * @version 0.1.0
  * @date 2026-01-10
  *
@@ -11,36 +11,12 @@
 #pragma once
 
 #include "gn10_can/core/fdcan_frame.hpp"
+#include "gn10_can/drivers/driver_interface.hpp"
 
 namespace gn10_can {
 namespace drivers {
 
-/**
- * @brief CAN通信ハードウェアインターフェースの抽象化クラス
- *
- */
-class IFDCANDriver
-{
-public:
-    virtual ~IFDCANDriver() = default;
-
-    /**
-     * @brief CANフレーム送信関数
-     *
-     * @param frame 送信するCANフレーム
-     * @return true 送信成功
-     * @return false 送信失敗
-     */
-    virtual bool send(const FDCANFrame& frame) = 0;
+using IFDCANDriver = BasicDriver<FDCANFrame>;  // CAN FD通信ハードウェアインターフェース
 
-    /**
-     * @brief CANフレーム受信関数
-     *
-     * @param out_frame 受信したCANフレームの格納先
-     * @return true 受信成功
-     * @return false 受信失敗（受信データなしなど）
-     */
-    virtual bool receive(FDCANFrame& out_frame) = 0;
-};
 }  // namespace drivers
 }  // namespace gn10_can
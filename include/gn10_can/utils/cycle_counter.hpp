@@ -0,0 +1,80 @@
+/**
+ * @file cycle_counter.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 処理時間の計測に使う時計 (Cortex-M の DWT サイクルカウンタ / Linux の clock_gettime)
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+namespace gn10_can {
+
+/**
+ * @brief 処理時間の計測に使うカウンタの現在値を返す関数
+ *
+ * 単位は問いませんが、32bit で一周する単調増加のカウンタであること
+ * （差分のみを使うため、一周しても計測区間が1周期より短ければ正しく計算されます）。
+ */
+using CycleCounter = uint32_t (*)();
+
+namespace utils {
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/**
+ * @brief DWT サイクルカウンタを有効にする (Cortex-M3/M4/M7/M33)
+ *
+ * 起動時に1度呼び出してください。CMSIS に依存しないよう、レジスタを直接操作します。
+ * Cortex-M0/M0+ には DWT サイクルカウンタがないため、タイマーのカウンタを使ってください。
+ */
+inline void enable_dwt_cycle_counter()
+{
+    volatile uint32_t* demcr    = reinterpret_cast<volatile uint32_t*>(0xE000EDFCu);
+    volatile uint32_t* dwt_lar  = reinterpret_cast<volatile uint32_t*>(0xE0001FB0u);
+    volatile uint32_t* dwt_ctrl = reinterpret_cast<volatile uint32_t*>(0xE0001000u);
+    volatile uint32_t* cyccnt   = reinterpret_cast<volatile uint32_t*>(0xE0001004u);
+
+    *demcr |= (1u << 24);  // TRCENA: DWT を有効にする
+
+    *dwt_lar = 0xC5ACCE55u;  // Cortex-M7 の書き込みロックを解除する（他のコアでは無視される）
+    *cyccnt  = 0;
+
+    *dwt_ctrl |= 1u;  // CYCCNTENA: サイクルカウンタを開始する
+}
+
+/**
+ * @brief DWT サイクルカウンタの現在値を取得する（CycleCounter として登録可能）
+ *
+ * @return uint32_t CPU クロックのサイクル数
+ */
+inline uint32_t dwt_cycle_counter()
+{
+    return *reinterpret_cast<volatile uint32_t*>(0xE0001004u);
+}
+#endif
+
+#if defined(__linux__)
+/**
+ * @brief 単調増加時計の現在値を取得する（CycleCounter として登録可能）
+ *
+ * @return uint32_t 現在時刻[ns]（約4.3秒で一周する）
+ */
+inline uint32_t monotonic_ns()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t sec_ns = static_cast<uint64_t>(ts.tv_sec) * 1000000000u;
+    return static_cast<uint32_t>(sec_ns + static_cast<uint64_t>(ts.tv_nsec));
+}
+#endif
+
+}  // namespace utils
+}  // namespace gn10_can
@@ -0,0 +1,173 @@
+/**
+ * @file latency_histogram.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 処理時間を2の冪ごとの区間で数える固定長ヒストグラム
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace gn10_can {
+namespace utils {
+
+/**
+ * @brief log2 区間のヒストグラム
+ *
+ * 区間 0 は値0、区間 k (k >= 1) は [2^(k-1), 2^k) の値を数えます。
+ * 記録は加算とビット数の計算だけで済むため、割り込みや制御ループの中でも使えます。
+ * 値の単位（サイクル数・ナノ秒など）は記録する側の時計に従います。
+ *
+ * 記録と読み出しは同じ実行コンテキストから行ってください（排他制御は行いません）。
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t BUCKET_COUNT = 33;  // 値0 と 32bit の各ビット数
+
+    /**
+     * @brief 値を1つ記録する
+     *
+     * @param value 処理時間
+     */
+    void record(uint32_t value)
+    {
+        buckets_[bucket_of(value)]++;
+        count_++;
+        if (value > max_) {
+            max_ = value;
+        }
+    }
+
+    /**
+     * @brief 記録した値をすべて消去する
+     *
+     */
+    void reset()
+    {
+        buckets_.fill(0);
+        count_ = 0;
+        max_   = 0;
+    }
+
+    /**
+     * @brief 記録した値の数を取得する
+     *
+     * @return uint32_t 記録数
+     */
+    uint32_t count() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief 記録した値の最大値を取得する
+     *
+     * @return uint32_t 最大値（記録がない場合は0）
+     */
+    uint32_t max() const
+    {
+        return max_;
+    }
+
+    /**
+     * @brief 区間の記録数を取得する
+     *
+     * @param index 区間の番号 (0 〜 BUCKET_COUNT - 1)
+     * @return uint32_t 記録数（範囲外の場合は0）
+     */
+    uint32_t bucket(std::size_t index) const
+    {
+        if (index >= BUCKET_COUNT) {
+            return 0;
+        }
+        return buckets_[index];
+    }
+
+    /**
+     * @brief パーセンタイル値を取得する
+     *
+     * 該当する値を含む区間の上限を返すため、誤差は最大で実際の値の約2倍です
+     * （ただし最大値を超えることはありません）。
+     *
+     * @param percent パーセンタイル (0 〜 100、p99 なら 99)
+     * @return uint32_t パーセンタイル値（記録がない場合は0）
+     */
+    uint32_t percentile(uint32_t percent) const
+    {
+        if (count_ == 0) {
+            return 0;
+        }
+        if (percent > 100) {
+            percent = 100;
+        }
+        // 小さい方から数えて rank 番目 (1始まり、切り上げ) の値を含む区間を探す
+        uint64_t rank = (static_cast<uint64_t>(count_) * percent + 99) / 100;
+        if (rank == 0) {
+            rank = 1;
+        }
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) {
+                uint32_t upper = bucket_upper_bound(i);
+                if (upper > max_) {
+                    return max_;
+                }
+                return upper;
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * @brief 値が入る区間の番号を取得する
+     *
+     * @param value 値
+     * @return std::size_t 区間の番号（値のビット数）
+     */
+    static std::size_t bucket_of(uint32_t value)
+    {
+        if (value == 0) {
+            return 0;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(32 - __builtin_clz(value));  // Cortex-M3 以上は CLZ 命令1つ
+#else
+        std::size_t bits = 0;
+        while (value != 0) {
+            value >>= 1;
+            bits++;
+        }
+        return bits;
+#endif
+    }
+
+    /**
+     * @brief 区間に入る値の上限を取得する
+     *
+     * @param index 区間の番号
+     * @return uint32_t 区間の最大値 (2^index - 1)
+     */
+    static uint32_t bucket_upper_bound(std::size_t index)
+    {
+        if (index >= 32) {
+            return UINT32_MAX;
+        }
+        return static_cast<uint32_t>((uint64_t{1} << index) - 1);
+    }
+
+private:
+    std::array<uint32_t, BUCKET_COUNT> buckets_{};  // 区間ごとの記録数
+    uint32_t count_ = 0;                            // 記録数
+    uint32_t max_   = 0;                            // 最大値
+};
+
+}  // namespace utils
+}  // namespace gn10_can
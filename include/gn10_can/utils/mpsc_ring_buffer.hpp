@@ -0,0 +1,151 @@
+/**
+ * @file mpsc_ring_buffer.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 複数スレッドから送信し1スレッドで取り出す多生産者・単一消費者のリングバッファのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace gn10_can {
+namespace utils {
+
+/**
+ * @brief 多生産者・単一消費者 (MPSC) の lock-free リングバッファ
+ *
+ * 各要素に世代番号を持たせ、生産者は書き込み位置を CAS で確保してから要素を書き込みます
+ * (D. Vyukov の bounded queue)。ロックを使わないため、生産者が途中で止まっても他の生産者は進めます。
+ * 生産者は何スレッドからでも try_push() (または try_reserve() / publish()) を呼べますが、
+ * try_pop() は1スレッドからのみ呼びます。
+ *
+ * @tparam T 格納する要素の型
+ * @tparam N 容量（2のべき乗）
+ */
+template <typename T, std::size_t N>
+class MPSCRingBuffer
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr std::size_t CAPACITY = N;
+
+    MPSCRingBuffer()
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCRingBuffer(const MPSCRingBuffer&)            = delete;
+    MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+    /**
+     * @brief 要素を追加する（生産者側、複数スレッドから呼び出し可能）
+     *
+     * @param value 追加する要素
+     * @return true 追加成功
+     * @return false 満杯のため追加できなかった
+     */
+    bool try_push(const T& value)
+    {
+        std::size_t position = 0;
+        T* slot              = try_reserve(position);
+        if (slot == nullptr) {
+            return false;
+        }
+        *slot = value;
+        publish(position);
+        return true;
+    }
+
+    /**
+     * @brief 書き込み位置を確保し、その要素を直接書き込めるようにする（生産者側）
+     *
+     * 確保した要素は publish() するまで消費者に見えません。消費者は確保順に取り出すため、
+     * 確保から publish() までの間は後続の要素も取り出されません。確保したら速やかに publish() してください。
+     *
+     * @param out_position 確保した位置の格納先（reserved() / publish() に渡す）
+     * @return T* 確保した要素（満杯の場合は nullptr）
+     */
+    T* try_reserve(std::size_t& out_position)
+    {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell        = cells_[pos & (N - 1)];
+            std::size_t seq   = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t df = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (df == 0) {
+                // 空きセル: 書き込み位置を確保できれば返す（失敗時 pos は最新値に更新される）
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out_position = pos;
+                    return &cell.value;
+                }
+            } else if (df < 0) {
+                return nullptr;  // 消費者がまだ取り出していない（満杯）
+            } else {
+                pos = head_.load(std::memory_order_relaxed);  // 他の生産者に先を越された
+            }
+        }
+    }
+
+    /**
+     * @brief try_reserve() で確保した要素を取得する（確保した生産者側）
+     *
+     * @param position try_reserve() で確保した位置
+     * @return T& 確保した要素
+     */
+    T& reserved(std::size_t position)
+    {
+        return cells_[position & (N - 1)].value;
+    }
+
+    /**
+     * @brief try_reserve() で確保した要素を書き終え、消費者が取り出せるようにする（生産者側）
+     *
+     * @param position try_reserve() で確保した位置
+     */
+    void publish(std::size_t position)
+    {
+        cells_[position & (N - 1)].sequence.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 要素を取り出す（消費者側、1スレッドからのみ呼び出し可能）
+     *
+     * @param out_value 取り出した要素の格納先
+     * @return true 取り出し成功
+     * @return false 空（または書き込み途中）のため取り出せなかった
+     */
+    bool try_pop(T& out_value)
+    {
+        Cell& cell      = cells_[tail_ & (N - 1)];
+        std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != tail_ + 1) {
+            return false;
+        }
+        out_value = cell.value;
+        cell.sequence.store(tail_ + N, std::memory_order_release);
+        tail_++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};  // 書き込み可能・読み出し可能を表す世代番号
+        T value{};                             // 要素
+    };
+
+    std::array<Cell, N> cells_;         // 要素の格納領域
+    std::atomic<std::size_t> head_{0};  // 次に確保する書き込み位置（生産者が CAS で更新）
+    std::size_t tail_ = 0;              // 次に読み出す位置（消費者のみ更新）
+};
+
+}  // namespace utils
+}  // namespace gn10_can
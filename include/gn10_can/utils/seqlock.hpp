@@ -0,0 +1,139 @@
+/**
+ * @file seqlock.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 1スレッドが更新し複数スレッドが読み出す値を、途中の状態を見せずに公開するシーケンスロック
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace gn10_can {
+namespace utils {
+
+/**
+ * @brief 単一書き込み・複数読み出しのシーケンスロック
+ *
+ * 書き込み側 (受信スレッド) は store() で値全体を更新し、読み出し側は load() / try_load() で
+ * 一貫したスナップショットを取得します。書き込み側は必ず1つのコンテキストに限ってください。書き込み中に読み出した場合は読み直すため、
+ * 複数のフィールドが混ざった値 (torn read) を返すことはありません。
+ * 書き込み側は待たされず、動的メモリも使用しません。
+ *
+ * 値は32bitのアトミック変数に分けて保持するため、データ競合 (ThreadSanitizer の検出対象) にもなりません。
+ *
+ * @tparam T 保持する値の型（トリビアルコピー可能であること）
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock requires a trivially copyable type");
+
+public:
+    SeqLock()
+    {
+        store_words(T{});
+    }
+
+    /**
+     * @brief 初期値を指定するコンストラクタ
+     *
+     * @param value 初期値
+     */
+    explicit SeqLock(const T& value)
+    {
+        store_words(value);
+    }
+
+    SeqLock(const SeqLock&)            = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief 値を更新する（書き込み側、1スレッドからのみ呼び出し可能）
+     *
+     * @param value 新しい値
+     */
+    void store(const T& value)
+    {
+        uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);  // 奇数: 書き込み中
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief 一貫したスナップショットを取得する（書き込み側以外のスレッドから呼び出し可能）
+     *
+     * 書き込み中は書き込みが終わるまで読み直します。書き込み側を中断して実行される割り込みから
+     * 呼ぶと書き込みが終わらず戻らないため、割り込みからは try_load() を使ってください。
+     *
+     * @return T 値
+     */
+    T load() const
+    {
+        T value{};
+        while (!try_load(value, 1)) {
+        }
+        return value;
+    }
+
+    /**
+     * @brief 回数を限ってスナップショットの取得を試みる（割り込みを含むどのコンテキストからも呼び出し可能）
+     *
+     * 書き込み中、または読み出し中に書き込まれた場合は max_attempts 回まで読み直し、
+     * それでも取得できなければ失敗します。待ち続けることはありません。
+     *
+     * @param out 取得した値の格納先（失敗時は変更しない）
+     * @param max_attempts 読み出しを試みる最大回数
+     * @return true 取得成功
+     * @return false 書き込みと重なったため取得できなかった
+     */
+    bool try_load(T& out, std::size_t max_attempts = DEFAULT_ATTEMPTS) const
+    {
+        std::array<uint32_t, WORD_COUNT> words{};
+        for (std::size_t attempt = 0; attempt < max_attempts; ++attempt) {
+            uint32_t before = sequence_.load(std::memory_order_acquire);
+            if ((before & 1u) != 0) {
+                continue;  // 書き込み中
+            }
+            for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static constexpr std::size_t DEFAULT_ATTEMPTS = 4;  // try_load() の既定の試行回数
+
+private:
+    static constexpr std::size_t WORD_COUNT = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    void store_words(const T& value)
+    {
+        std::array<uint32_t, WORD_COUNT> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint32_t> sequence_{0};                   // 偶数: 安定、奇数: 書き込み中
+    std::array<std::atomic<uint32_t>, WORD_COUNT> words_;  // 値を32bitずつ保持する
+};
+
+}  // namespace utils
+}  // namespace gn10_can
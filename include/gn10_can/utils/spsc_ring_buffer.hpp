@@ -0,0 +1,139 @@
+/**
+ * @file spsc_ring_buffer.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 割り込みとメインループ間で使う単一生産者・単一消費者のリングバッファのヘッダーファイル
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace gn10_can {
+namespace utils {
+
+/**
+ * @brief 単一生産者・単一消費者 (SPSC) の wait-free リングバッファ
+ *
+ * 生産者 (受信割り込みなど) は try_push() のみ、消費者 (メインループ) は try_pop() のみを呼びます。
+ * ロックを使わず、どちらの操作も一定時間で完了します。
+ *
+ * @tparam T 格納する要素の型
+ * @tparam N 容量（2のべき乗）
+ */
+template <typename T, std::size_t N>
+class SPSCRingBuffer
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr std::size_t CAPACITY = N;
+
+    /**
+     * @brief 要素を追加する（生産者側）
+     *
+     * @param value 追加する要素
+     * @return true 追加成功
+     * @return false 満杯のため追加できなかった
+     */
+    bool try_push(const T& value)
+    {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= N) {
+            return false;
+        }
+        buffer_[head & (N - 1)] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 要素を取り出す（消費者側）
+     *
+     * @param out_value 取り出した要素の格納先
+     * @return true 取り出し成功
+     * @return false 空のため取り出せなかった
+     */
+    bool try_pop(T& out_value)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        out_value = buffer_[tail & (N - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 先頭から連続して格納されている要素を、コピーせずに参照する（消費者側）
+     *
+     * 生産者は pop() されるまでこれらの要素の領域に書き込まないため、その間は参照・変更できます。
+     * 領域の末尾で折り返す場合は、末尾までの要素数を返します。
+     *
+     * @param out_front 先頭の要素を指すポインタの格納先
+     * @return std::size_t 参照できる要素数（空の場合は0）
+     */
+    std::size_t peek(T*& out_front)
+    {
+        std::size_t tail   = tail_.load(std::memory_order_relaxed);
+        std::size_t head   = head_.load(std::memory_order_acquire);
+        std::size_t index  = tail & (N - 1);
+        std::size_t count  = head - tail;
+        std::size_t to_end = N - index;
+        if (count > to_end) {
+            count = to_end;
+        }
+        out_front = &buffer_[index];
+        return count;
+    }
+
+    /**
+     * @brief peek() で参照した要素を先頭から取り除く（消費者側）
+     *
+     * @param count 取り除く要素数（直前の peek() の戻り値以下）
+     */
+    void pop(std::size_t count)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        tail_.store(tail + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief 格納されている要素数を取得する（どちらの側からも呼び出し可能、目安の値）
+     *
+     * @return std::size_t 要素数
+     */
+    std::size_t size() const
+    {
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    /**
+     * @brief 空かどうか
+     *
+     * @return true 空
+     * @return false 要素がある
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+private:
+    std::array<T, N> buffer_{};         // 要素の格納領域
+    std::atomic<std::size_t> head_{0};  // 次に書き込む位置（生産者のみ更新）
+    std::atomic<std::size_t> tail_{0};  // 次に読み出す位置（消費者のみ更新）
+};
+
+}  // namespace utils
+}  // namespace gn10_can
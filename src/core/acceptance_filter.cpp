@@ -0,0 +1,129 @@
+#include "gn10_can/core/acceptance_filter.hpp"
+
+#include <array>
+
+#include "gn10_can/core/can_id.hpp"
+
+namespace gn10_can {
+
+namespace {
+
+constexpr uint32_t ROUTING_ID_BITS  = id::BIT_WIDTH_DEV_TYPE + id::BIT_WIDTH_DEV_ID;
+constexpr uint32_t ROUTING_ID_COUNT = 1u << ROUTING_ID_BITS;
+constexpr uint32_t ROUTING_ID_MASK  = ROUTING_ID_COUNT - 1;
+
+/**
+ * @brief ルーティングIDの空間で表したフィルタ
+ *
+ */
+struct RoutingFilter {
+    uint32_t id   = 0;
+    uint32_t mask = ROUTING_ID_MASK;
+};
+
+/**
+ * @brief フィルタが受信するルーティングIDの数
+ *
+ */
+uint32_t accepted_count(const RoutingFilter& filter)
+{
+    uint32_t free_bits = 0;
+    for (uint32_t bit = 0; bit < ROUTING_ID_BITS; bit++) {
+        if ((filter.mask & (1u << bit)) == 0) {
+            free_bits++;
+        }
+    }
+    return 1u << free_bits;
+}
+
+/**
+ * @brief 2つのフィルタの両方を受信する最小のフィルタ
+ *
+ */
+RoutingFilter merge(const RoutingFilter& a, const RoutingFilter& b)
+{
+    RoutingFilter merged;
+    merged.mask = a.mask & b.mask & ~(a.id ^ b.id) & ROUTING_ID_MASK;
+    merged.id   = a.id & merged.mask;
+    return merged;
+}
+
+/**
+ * @brief outer が inner の受信するIDを全て受信するか
+ *
+ */
+bool covers(const RoutingFilter& outer, const RoutingFilter& inner)
+{
+    return (outer.mask & inner.mask) == outer.mask && (inner.id & outer.mask) == outer.id;
+}
+
+}  // namespace
+
+std::size_t build_acceptance_filters(
+    const uint32_t* routing_ids,
+    std::size_t id_count,
+    AcceptanceFilter* out_filters,
+    std::size_t max_filters
+)
+{
+    if (max_filters == 0) {
+        return 0;
+    }
+
+    // 重複を除いて、ルーティングIDごとの完全一致フィルタを作る
+    std::array<RoutingFilter, ROUTING_ID_COUNT> filters{};
+    std::array<bool, ROUTING_ID_COUNT> seen{};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < id_count; i++) {
+        uint32_t routing_id = routing_ids[i] & ROUTING_ID_MASK;
+        if (!seen[routing_id]) {
+            seen[routing_id]    = true;
+            filters[count++].id = routing_id;
+        }
+    }
+
+    // 余分に受信するIDが最も少なくなる組を、フィルタ数が予算に収まるまで統合する
+    while (count > max_filters) {
+        std::size_t best_a    = 0;
+        std::size_t best_b    = 1;
+        uint32_t best_penalty = UINT32_MAX;
+        for (std::size_t a = 0; a < count; a++) {
+            for (std::size_t b = a + 1; b < count; b++) {
+                uint32_t merged_count   = accepted_count(merge(filters[a], filters[b]));
+                uint32_t separate_count = accepted_count(filters[a]) + accepted_count(filters[b]);
+                uint32_t penalty        = 0;  // 一方が他方を含む場合は余分な受信なし
+                if (merged_count > separate_count) {
+                    penalty = merged_count - separate_count;
+                }
+                if (penalty < best_penalty) {
+                    best_penalty = penalty;
+                    best_a       = a;
+                    best_b       = b;
+                }
+            }
+        }
+
+        filters[best_a] = merge(filters[best_a], filters[best_b]);
+        filters[best_b] = filters[--count];
+
+        // 統合したフィルタに含まれるようになったフィルタを取り除く
+        for (std::size_t i = 0; i < count;) {
+            if (i != best_a && covers(filters[best_a], filters[i])) {
+                filters[i] = filters[--count];
+                if (best_a == count) {
+                    best_a = i;
+                }
+            } else {
+                i++;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        out_filters[i].id   = filters[i].id << id::BIT_WIDTH_COMMAND;
+        out_filters[i].mask = filters[i].mask << id::BIT_WIDTH_COMMAND;
+    }
+    return count;
+}
+
+}  // namespace gn10_can
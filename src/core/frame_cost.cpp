@@ -0,0 +1,272 @@
+#include "gn10_can/core/frame_cost.hpp"
+
+#include "gn10_can/core/fdcan_frame.hpp"
+
+namespace gn10_can {
+namespace frame_cost {
+
+namespace {
+
+// CRCデリミタ・ACKスロット・ACKデリミタ・EOF(7bit)・フレーム間スペース(3bit)
+constexpr uint32_t FRAME_TAIL_BITS = 13;
+
+constexpr uint16_t CRC15_POLYNOMIAL    = 0x4599;  // x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1
+constexpr uint32_t FD_STUFF_COUNT_BITS = 4;       // スタッフカウント (グレイコード3bit + パリティ)
+
+/**
+ * @brief フレームのビット列を先頭から流し込み、ビット数・スタッフビット・CRC15 を数える
+ *
+ */
+class BitCounter
+{
+public:
+    explicit BitCounter(Stuffing stuffing) : stuffing_(stuffing) {}
+
+    /**
+     * @brief 以降のビットをデータフェーズ（データビットレート）として数える
+     *
+     */
+    void enter_data_phase()
+    {
+        phase_ = DATA;
+    }
+
+    /**
+     * @brief スタッフィングの対象となるフィールドを上位ビットから流し込む
+     *
+     * @param value フィールドの値
+     * @param width フィールドのビット数
+     */
+    void push(uint32_t value, uint32_t width)
+    {
+        for (uint32_t i = width; i > 0; --i) {
+            push_bit(static_cast<uint8_t>((value >> (i - 1)) & 1u));
+        }
+    }
+
+    /**
+     * @brief スタッフィングの対象外のビットを加える
+     *
+     * @param count ビット数
+     */
+    void add_fixed(uint32_t count)
+    {
+        bits_[phase_] += count;
+    }
+
+    /**
+     * @brief CRC15 の計算を止める（CRCフィールド自体は CRC の対象外）
+     *
+     * @return uint16_t ここまでのビットの CRC15
+     */
+    uint16_t finish_crc()
+    {
+        crc_enabled_ = false;
+        return crc_;
+    }
+
+    /**
+     * @brief スタッフビットを含むビット数を取得する
+     *
+     * @return BitCount ビット数
+     */
+    BitCount result() const
+    {
+        BitCount count;
+        count.nominal_bits = bits_[NOMINAL];
+        count.data_bits    = bits_[DATA];
+        if (stuffing_ == Stuffing::WorstCase) {
+            // 先頭の1bitの後、4bitごとにスタッフビットが入るのが最悪 (00000 1111 0000 ...)
+            uint32_t stuffable = stuffable_[NOMINAL] + stuffable_[DATA];
+            uint32_t worst     = 0;
+            if (stuffable > 0) {
+                worst = (stuffable - 1) / 4;
+            }
+            uint32_t nominal_worst = 0;
+            if (stuffable_[NOMINAL] > 0) {
+                nominal_worst = (stuffable_[NOMINAL] - 1) / 4;
+            }
+            count.nominal_bits += nominal_worst;
+            count.data_bits += worst - nominal_worst;
+        }
+        return count;
+    }
+
+private:
+    static constexpr std::size_t NOMINAL = 0;
+    static constexpr std::size_t DATA    = 1;
+
+    void push_bit(uint8_t bit)
+    {
+        bits_[phase_]++;
+        stuffable_[phase_]++;
+        if (crc_enabled_) {
+            uint8_t crc_next = bit ^ static_cast<uint8_t>((crc_ >> 14) & 1u);
+            crc_             = static_cast<uint16_t>((crc_ << 1) & 0x7FFFu);
+            if (crc_next != 0) {
+                crc_ ^= CRC15_POLYNOMIAL;
+            }
+        }
+        if (stuffing_ != Stuffing::Actual) {
+            return;
+        }
+        if (run_length_ > 0 && bit == last_bit_) {
+            run_length_++;
+        } else {
+            last_bit_   = bit;
+            run_length_ = 1;
+        }
+        if (run_length_ == 5) {
+            // 同じ値が5bit続いたら反転したスタッフビットを挿入し、それを次の連続の1bit目とする
+            bits_[phase_]++;
+            last_bit_   = bit ^ 1u;
+            run_length_ = 1;
+        }
+    }
+
+    Stuffing stuffing_;                // スタッフビットの数え方
+    std::size_t phase_     = NOMINAL;  // 現在のフェーズ
+    uint32_t bits_[2]      = {0, 0};   // フェーズごとのビット数（スタッフビットを含む）
+    uint32_t stuffable_[2] = {0, 0};   // フェーズごとのスタッフィング対象のビット数
+    uint16_t crc_          = 0;        // CRC15
+    bool crc_enabled_      = true;     // CRC15 を計算中か
+    uint8_t last_bit_      = 0;        // 直前のビット
+    uint8_t run_length_    = 0;        // 同じ値の連続数
+};
+
+/**
+ * @brief CAN FD のデータ長から DLC を取得する
+ *
+ * @param padded_length fd_padded_length() で丸めたデータ長
+ * @return uint32_t DLC (0〜15)
+ */
+uint32_t fd_dlc(std::size_t padded_length)
+{
+    if (padded_length <= 8) {
+        return static_cast<uint32_t>(padded_length);
+    }
+    if (padded_length <= 24) {
+        return static_cast<uint32_t>(9 + (padded_length - 12) / 4);  // 12, 16, 20, 24
+    }
+    if (padded_length <= 32) {
+        return 13;
+    }
+    if (padded_length <= 48) {
+        return 14;
+    }
+    return 15;
+}
+
+/**
+ * @brief IDフィールドを流し込む（RTR / RRS の直前まで）
+ *
+ * @param counter 流し込み先
+ * @param id CAN ID
+ * @param is_extended 拡張IDか
+ */
+void push_id(BitCounter& counter, uint32_t id, bool is_extended)
+{
+    counter.push(0, 1);  // SOF
+    if (is_extended) {
+        counter.push((id >> 18) & 0x7FFu, 11);  // ベースID
+        counter.push(1, 1);                     // SRR
+        counter.push(1, 1);                     // IDE
+        counter.push(id & 0x3FFFFu, 18);        // 拡張ID
+    } else {
+        counter.push(id & 0x7FFu, 11);
+    }
+}
+
+}  // namespace
+
+BitCount classic_bits(
+    uint32_t id, bool is_extended, const uint8_t* data, std::size_t length, Stuffing stuffing
+)
+{
+    if (length > 8) {
+        length = 8;
+    }
+    BitCounter counter(stuffing);
+    push_id(counter, id, is_extended);
+    counter.push(0, 1);  // RTR (データフレーム)
+    counter.push(0, 2);  // 標準ID: IDE, r0 / 拡張ID: r1, r0
+    counter.push(static_cast<uint32_t>(length), 4);
+    for (std::size_t i = 0; i < length; ++i) {
+        counter.push(data[i], 8);
+    }
+    counter.push(counter.finish_crc(), 15);
+    counter.add_fixed(FRAME_TAIL_BITS);
+    return counter.result();
+}
+
+BitCount fd_bits(
+    uint32_t id,
+    bool is_extended,
+    const uint8_t* data,
+    std::size_t length,
+    bool bit_rate_switch,
+    Stuffing stuffing
+)
+{
+    if (length > 64) {
+        length = 64;
+    }
+    std::size_t padded = fd_padded_length(length);
+
+    BitCounter counter(stuffing);
+    push_id(counter, id, is_extended);
+    counter.push(0, 1);  // RRS
+    if (!is_extended) {
+        counter.push(0, 1);  // IDE
+    }
+    counter.push(1, 1);  // FDF
+    counter.push(0, 1);  // res
+    if (bit_rate_switch) {
+        counter.push(1, 1);  // BRS（サンプル点以降はデータビットレート）
+        counter.enter_data_phase();
+    } else {
+        counter.push(0, 1);
+    }
+    counter.push(0, 1);  // ESI (エラーアクティブ)
+    counter.push(fd_dlc(padded), 4);
+    for (std::size_t i = 0; i < padded; ++i) {
+        uint8_t byte = 0;  // 詰め物は0とする
+        if (i < length) {
+            byte = data[i];
+        }
+        counter.push(byte, 8);
+    }
+
+    // CRCフィールドは固定スタッフビット: スタッフカウントの前と、以降4bitごとに1bit
+    uint32_t crc_bits = 17;
+    if (padded > 16) {
+        crc_bits = 21;
+    }
+    uint32_t fixed_stuff_bits = 1 + (FD_STUFF_COUNT_BITS + crc_bits) / 4;
+    counter.add_fixed(FD_STUFF_COUNT_BITS + crc_bits + fixed_stuff_bits);
+
+    BitCount count = counter.result();
+    count.nominal_bits += FRAME_TAIL_BITS;
+    return count;
+}
+
+std::size_t fd_padded_length(std::size_t length)
+{
+    return FDCANFrame::padded_length(length);
+}
+
+uint32_t duration_ns(const BitCount& bits, uint32_t nominal_bitrate, uint32_t data_bitrate)
+{
+    if (nominal_bitrate == 0) {
+        return 0;
+    }
+    if (data_bitrate == 0) {
+        data_bitrate = nominal_bitrate;
+    }
+    uint64_t nominal_ns = static_cast<uint64_t>(bits.nominal_bits) * 1000000000u / nominal_bitrate;
+    uint64_t data_ns    = static_cast<uint64_t>(bits.data_bits) * 1000000000u / data_bitrate;
+    return static_cast<uint32_t>(nominal_ns + data_ns);
+}
+
+}  // namespace frame_cost
+}  // namespace gn10_can
@@ -3,52 +3,70 @@
 #include "gn10_can/utils/can_converter.hpp"
 namespace gn10_can {
 namespace devices {
-ESCHubClient::ESCHubClient(FDCANBus& bus, uint8_t device_id)
-    : FDCANDevice(bus, id::DeviceType::MotorDriver, device_id)
+constexpr ESCHubClient::CommandTable ESCHubClient::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeESCHub::AngularVelocitiesFeedbacks)] =
+        command_handler<ESCHubClient, &ESCHubClient::handle_angular_velocities_feedbacks>;
+    return table;
+}();
+
+ESCHubClient::ESCHubClient(IFDCANBus& bus, uint8_t device_id)
+    : FDCANDevice(bus, id::DeviceType::ESCHub, device_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
-void ESCHubClient::set_gain_all(const ESCHubConfig& esc_hub_config)
+bool ESCHubClient::set_gain_all(const ESCHubConfig& esc_hub_config)
 {
-    FDCANFrame frame =
-        FDCANFrame::make(id::DeviceType::ESCHub, device_id_, id::MsgTypeESCHub::Gain);
+    FDCANFrame frame;
+    frame.id = can_id(id::MsgTypeESCHub::Gain);
     converter::pack(frame.data, 0, esc_hub_config);
     frame.dlc = sizeof(ESCHubConfig);
-    bus_.send_frame(frame);
+    return send_frame(frame);
 }
 
-void ESCHubClient::set_angular_velocities(float angular_velocities[4])
+bool ESCHubClient::set_angular_velocities(float angular_velocities[4])
 {
-    FDCANFrame frame =
-        FDCANFrame::make(id::DeviceType::ESCHub, device_id_, id::MsgTypeESCHub::AngularVelocities);
+    FDCANFrame frame;
+    frame.id = can_id(id::MsgTypeESCHub::AngularVelocities);
     for (int i = 0; i < 4; i++) {
         converter::pack(frame.data, i * sizeof(float), angular_velocities[i]);
     }
     frame.dlc = sizeof(float) * 4;
-    bus_.send_frame(frame);
+    return send_frame(frame, TxMode::Coalesce);
 }
 
 bool ESCHubClient::get_angular_velocity_feedbacks(float angular_velocity_feedbacks[4])
 {
-    if (angular_velocity_feedback_.has_value()) {
-        for (int i = 0; i < 4; i++) {
-            angular_velocity_feedbacks[i] =
-                angular_velocity_feedback_->angular_velocity_feedback[i];
-        }
-        angular_velocity_feedback_.reset();
-        return true;
+    TimestampUs received_at_us;
+    return get_angular_velocity_feedbacks(angular_velocity_feedbacks, received_at_us);
+}
+
+bool ESCHubClient::get_angular_velocity_feedbacks(
+    float angular_velocity_feedbacks[4], TimestampUs& received_at_us
+)
+{
+    AngularVelocityFeedbacks feedbacks = angular_velocity_feedback_.load();
+    if (feedbacks.received_count == read_count_) {
+        return false;
+    }
+    read_count_    = feedbacks.received_count;
+    received_at_us = feedbacks.received_at_us;
+    for (int i = 0; i < 4; i++) {
+        angular_velocity_feedbacks[i] = feedbacks.angular_velocity_feedback[i];
     }
-    return false;
+    return true;
 }
 
-void ESCHubClient::on_receive(const FDCANFrame& frame)
+void ESCHubClient::handle_angular_velocities_feedbacks(const FDCANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
-    if (id_fields.is_command(id::MsgTypeESCHub::AngularVelocitiesFeedbacks)) {
-        AngularVelocityFeedbacks feedbacks;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, feedbacks)) {
-            angular_velocity_feedback_ = feedbacks;
-        }
+    AngularVelocityFeedbacks feedbacks = angular_velocity_feedback_.load();
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, feedbacks.angular_velocity_feedback)) {
+        feedbacks.received_at_us = frame.timestamp();
+        feedbacks.received_count++;
+        angular_velocity_feedback_.store(feedbacks);
+    } else {
+        count_parse_failure();
     }
 }
 }  // namespace devices
@@ -3,9 +3,19 @@
 #include "gn10_can/utils/can_converter.hpp"
 namespace gn10_can {
 namespace devices {
-ESCHubServer::ESCHubServer(FDCANBus& bus, uint8_t device_id)
+constexpr ESCHubServer::CommandTable ESCHubServer::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeESCHub::Gain)] =
+        command_handler<ESCHubServer, &ESCHubServer::handle_gain>;
+    table[command_index(id::MsgTypeESCHub::AngularVelocities)] =
+        command_handler<ESCHubServer, &ESCHubServer::handle_angular_velocities>;
+    return table;
+}();
+
+ESCHubServer::ESCHubServer(IFDCANBus& bus, uint8_t device_id)
     : FDCANDevice(bus, id::DeviceType::ESCHub, device_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
 bool ESCHubServer::get_gain(ESCHubConfig& esc_hub_config)
@@ -30,20 +40,23 @@ bool ESCHubServer::get_angular_velocities(float angular_velocities[4])
     return false;
 }
 
-void ESCHubServer::on_receive(const FDCANFrame& frame)
+void ESCHubServer::handle_gain(const FDCANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
+    ESCHubConfig config;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, config)) {
+        motor_gain_ = config;
+    } else {
+        count_parse_failure();
+    }
+}
 
-    if (id_fields.is_command(id::MsgTypeESCHub::Gain)) {
-        ESCHubConfig config;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, config)) {
-            motor_gain_ = config;
-        }
-    } else if (id_fields.is_command(id::MsgTypeESCHub::AngularVelocities)) {
-        AngularVelocities config;
-        if (converter::unpack(frame.data, 0, config)) {
-            angular_velocity_ = config;
-        }
+void ESCHubServer::handle_angular_velocities(const FDCANFrame& frame)
+{
+    AngularVelocities config;
+    if (converter::unpack(frame.data, 0, config)) {
+        angular_velocity_ = config;
+    } else {
+        count_parse_failure();
     }
 }
 }  // namespace devices
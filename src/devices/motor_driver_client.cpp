@@ -5,74 +5,109 @@
 namespace gn10_can {
 namespace devices {
 
-MotorDriverClient::MotorDriverClient(CANBus& bus, uint8_t dev_id)
+constexpr MotorDriverClient::CommandTable MotorDriverClient::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeMotorDriver::Feedback)] =
+        command_handler<MotorDriverClient, &MotorDriverClient::handle_feedback>;
+    table[command_index(id::MsgTypeMotorDriver::HardwareStatus)] =
+        command_handler<MotorDriverClient, &MotorDriverClient::handle_hardware_status>;
+    return table;
+}();
+
+MotorDriverClient::MotorDriverClient(ICANBus& bus, uint8_t dev_id)
     : CANDevice(bus, id::DeviceType::MotorDriver, dev_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
-void MotorDriverClient::set_init(const MotorConfig& config)
+bool MotorDriverClient::set_init(const MotorConfig& config)
 {
-    send(id::MsgTypeMotorDriver::Init, config.to_bytes());
+    return send(id::MsgTypeMotorDriver::Init, config.to_bytes());
 }
 
-void MotorDriverClient::set_target(float target)
+bool MotorDriverClient::set_target(float target)
 {
     std::array<uint8_t, 4> payload{};
     converter::pack(payload, 0, target);
-    send(id::MsgTypeMotorDriver::Target, payload);
+    return send(id::MsgTypeMotorDriver::Target, payload, TxMode::Coalesce);
 }
 
-void MotorDriverClient::set_gain(devices::GainType type, float value)
+bool MotorDriverClient::set_gain(devices::GainType type, float value)
 {
     std::array<uint8_t, 5> payload{};
     payload[0] = static_cast<uint8_t>(type);
     converter::pack(payload, 1, value);
-    send(id::MsgTypeMotorDriver::Gain, payload);
+    return send(id::MsgTypeMotorDriver::Gain, payload);
+}
+
+void MotorDriverClient::handle_feedback(const CANFrame& frame)
+{
+    MotorFeedback feedback = feedback_.load();
+    float val;
+    uint8_t sw;
+    bool has_value  = converter::unpack(frame.data.data(), frame.dlc, 0, val);
+    bool has_switch = converter::unpack(frame.data.data(), frame.dlc, 4, sw);
+    if (has_value) {
+        feedback.value = val;
+    }
+    if (has_switch) {
+        feedback.limit_switches = sw;
+    }
+    if (!has_value || !has_switch) {
+        count_parse_failure();
+    }
+    feedback.received_at_us = frame.timestamp();
+    feedback_.store(feedback);
 }
 
-void MotorDriverClient::on_receive(const CANFrame& frame)
+void MotorDriverClient::handle_hardware_status(const CANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
-
-    if (id_fields.is_command(id::MsgTypeMotorDriver::Feedback)) {
-        float val;
-        uint8_t sw;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, val)) {
-            feedback_value_ = val;
-        }
-        if (converter::unpack(frame.data.data(), frame.dlc, 4, sw)) {
-            limit_switches_ = sw;
-        }
-    } else if (id_fields.is_command(id::MsgTypeMotorDriver::HardwareStatus)) {
-        float curr;
-        int8_t temp;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, curr)) {
-            load_current_ = curr;
-        }
-        if (converter::unpack(frame.data.data(), frame.dlc, 4, temp)) {
-            temperature_ = temp;
-        }
+    MotorHardwareStatus status = hardware_status_.load();
+    float curr;
+    int8_t temp;
+    bool has_current     = converter::unpack(frame.data.data(), frame.dlc, 0, curr);
+    bool has_temperature = converter::unpack(frame.data.data(), frame.dlc, 4, temp);
+    if (has_current) {
+        status.load_current = curr;
+    }
+    if (has_temperature) {
+        status.temperature = temp;
     }
+    if (!has_current || !has_temperature) {
+        count_parse_failure();
+    }
+    status.received_at_us = frame.timestamp();
+    hardware_status_.store(status);
+}
+
+MotorFeedback MotorDriverClient::feedback() const
+{
+    return feedback_.load();
+}
+
+MotorHardwareStatus MotorDriverClient::hardware_status() const
+{
+    return hardware_status_.load();
 }
 
 float MotorDriverClient::feedback_value() const
 {
-    return feedback_value_;
+    return feedback_.load().value;
 }
 
 uint8_t MotorDriverClient::limit_switches() const
 {
-    return limit_switches_;
+    return feedback_.load().limit_switches;
 }
 
 float MotorDriverClient::load_current() const
 {
-    return load_current_;
+    return hardware_status_.load().load_current;
 }
 
 int8_t MotorDriverClient::temperature() const
 {
-    return temperature_;
+    return hardware_status_.load().temperature;
 }
 
 }  // namespace devices
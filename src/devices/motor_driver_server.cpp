@@ -5,25 +5,37 @@
 namespace gn10_can {
 namespace devices {
 
-MotorDriverServer::MotorDriverServer(CANBus& bus, uint8_t dev_id)
+constexpr MotorDriverServer::CommandTable MotorDriverServer::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeMotorDriver::Init)] =
+        command_handler<MotorDriverServer, &MotorDriverServer::handle_init>;
+    table[command_index(id::MsgTypeMotorDriver::Target)] =
+        command_handler<MotorDriverServer, &MotorDriverServer::handle_target>;
+    table[command_index(id::MsgTypeMotorDriver::Gain)] =
+        command_handler<MotorDriverServer, &MotorDriverServer::handle_gain>;
+    return table;
+}();
+
+MotorDriverServer::MotorDriverServer(ICANBus& bus, uint8_t dev_id)
     : CANDevice(bus, id::DeviceType::MotorDriver, dev_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
-void MotorDriverServer::send_feedback(float feedback_val, uint8_t limit_switch_state)
+bool MotorDriverServer::send_feedback(float feedback_val, uint8_t limit_switch_state)
 {
     std::array<uint8_t, 5> payload{};
     converter::pack(payload, 0, feedback_val);
     converter::pack(payload, 4, limit_switch_state);
-    send(id::MsgTypeMotorDriver::Feedback, payload);
+    return send(id::MsgTypeMotorDriver::Feedback, payload);
 }
 
-void MotorDriverServer::send_hardware_status(float load_current, int8_t temperature)
+bool MotorDriverServer::send_hardware_status(float load_current, int8_t temperature)
 {
     std::array<uint8_t, 5> payload{};
     converter::pack(payload, 0, load_current);
     converter::pack(payload, 4, temperature);
-    send(id::MsgTypeMotorDriver::HardwareStatus, payload);
+    return send(id::MsgTypeMotorDriver::HardwareStatus, payload);
 }
 
 bool MotorDriverServer::get_new_init(MotorConfig& config)
@@ -57,26 +69,30 @@ bool MotorDriverServer::get_new_gain(GainType type, float& value)
     return false;
 }
 
-void MotorDriverServer::on_receive(const CANFrame& frame)
+void MotorDriverServer::handle_init(const CANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
+    config_ = MotorConfig::from_bytes(frame.data);
+}
 
-    if (id_fields.is_command(id::MsgTypeMotorDriver::Init)) {
-        config_ = MotorConfig::from_bytes(frame.data);
-    } else if (id_fields.is_command(id::MsgTypeMotorDriver::Target)) {
-        float val;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, val)) {
-            target_ = val;
-        }
-    } else if (id_fields.is_command(id::MsgTypeMotorDriver::Gain)) {
-        if (frame.dlc >= 5) {
-            uint8_t type_val = frame.data[0];
-            float gain_val;
-            if (type_val < static_cast<uint8_t>(GainType::Count) &&
-                converter::unpack(frame.data.data(), frame.dlc, 1, gain_val)) {
-                gains_[type_val] = gain_val;
-            }
-        }
+void MotorDriverServer::handle_target(const CANFrame& frame)
+{
+    float val;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, val)) {
+        target_ = val;
+    } else {
+        count_parse_failure();
+    }
+}
+
+void MotorDriverServer::handle_gain(const CANFrame& frame)
+{
+    uint8_t type_val = frame.data[0];
+    float gain_val;
+    if (frame.dlc >= 5 && type_val < static_cast<uint8_t>(GainType::Count) &&
+        converter::unpack(frame.data.data(), frame.dlc, 1, gain_val)) {
+        gains_[type_val] = gain_val;
+    } else {
+        count_parse_failure();
     }
 }
 
@@ -5,24 +5,24 @@
 namespace gn10_can {
 namespace devices {
 
-ServoMotorClient::ServoMotorClient(CANBus& bus, uint8_t device_id)
+ServoMotorClient::ServoMotorClient(ICANBus& bus, uint8_t device_id)
     : CANDevice(bus, id::DeviceType::ServoMotor, device_id)
 {
 }
 
-void ServoMotorClient::set_init(uint16_t min_us, uint16_t max_us)
+bool ServoMotorClient::set_init(uint16_t min_us, uint16_t max_us)
 {
     std::array<uint8_t, 4> payload{};
     converter::pack(payload, 0, min_us);
     converter::pack(payload, 2, max_us);
-    send(id::MsgTypeServoMotor::Init, payload);
+    return send(id::MsgTypeServoMotor::Init, payload);
 }
 
-void ServoMotorClient::set_angle_rad(float angle_rad)
+bool ServoMotorClient::set_angle_rad(float angle_rad)
 {
     std::array<uint8_t, 4> payload{};
     converter::pack(payload, 0, angle_rad);
-    send(id::MsgTypeServoMotor::AngleRad, payload);
+    return send(id::MsgTypeServoMotor::AngleRad, payload, TxMode::Coalesce);
 }
 
 }  // namespace devices
@@ -4,9 +4,19 @@
 
 namespace gn10_can {
 namespace devices {
-ServoMotorServer::ServoMotorServer(CANBus& bus, uint8_t device_id)
+constexpr ServoMotorServer::CommandTable ServoMotorServer::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeServoMotor::Init)] =
+        command_handler<ServoMotorServer, &ServoMotorServer::handle_init>;
+    table[command_index(id::MsgTypeServoMotor::AngleRad)] =
+        command_handler<ServoMotorServer, &ServoMotorServer::handle_angle_rad>;
+    return table;
+}();
+
+ServoMotorServer::ServoMotorServer(ICANBus& bus, uint8_t device_id)
     : CANDevice(bus, id::DeviceType::ServoMotor, device_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
 bool ServoMotorServer::get_new_init(uint16_t& min_us, uint16_t& max_us)
@@ -28,22 +38,25 @@ bool ServoMotorServer::get_new_angle_rad(float& angle_rad)
     }
     return false;
 }
-void ServoMotorServer::on_receive(const CANFrame& frame)
+void ServoMotorServer::handle_init(const CANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
+    uint16_t min_us = 0;
+    uint16_t max_us = 0;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, min_us) &&
+        converter::unpack(frame.data.data(), frame.dlc, 2, max_us)) {
+        pulse_set_ = PulseSet{min_us, max_us};
+    } else {
+        count_parse_failure();
+    }
+}
 
-    if (id_fields.is_command(id::MsgTypeServoMotor::Init)) {
-        uint16_t min_us = 0;
-        uint16_t max_us = 0;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, min_us) &&
-            converter::unpack(frame.data.data(), frame.dlc, 2, max_us)) {
-            pulse_set_ = PulseSet{min_us, max_us};
-        }
-    } else if (id_fields.is_command(id::MsgTypeServoMotor::AngleRad)) {
-        float target_angle = 0.0f;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, target_angle)) {
-            angle_rad_ = target_angle;
-        }
+void ServoMotorServer::handle_angle_rad(const CANFrame& frame)
+{
+    float target_angle = 0.0f;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, target_angle)) {
+        angle_rad_ = target_angle;
+    } else {
+        count_parse_failure();
     }
 }
 }  // namespace devices
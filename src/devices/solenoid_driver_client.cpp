@@ -5,34 +5,32 @@
 namespace gn10_can {
 namespace devices {
 
-SolenoidDriverClient::SolenoidDriverClient(CANBus& bus, uint8_t dev_id)
+SolenoidDriverClient::SolenoidDriverClient(ICANBus& bus, uint8_t dev_id)
     : CANDevice(bus, id::DeviceType::SolenoidDriver, dev_id)
 {
 }
 
-void SolenoidDriverClient::set_init()
+bool SolenoidDriverClient::set_init()
 {
     std::array<uint8_t, 1> init{0};
-    send(id::MsgTypeSolenoidDriver::Init, init);
+    return send(id::MsgTypeSolenoidDriver::Init, init);
 }
 
-void SolenoidDriverClient::set_target(const uint8_t& target)
+bool SolenoidDriverClient::set_target(const uint8_t& target)
 {
     std::array<uint8_t, 1> payload{};
     converter::pack(payload, 0, target);
-    send(id::MsgTypeSolenoidDriver::Target, payload);
+    return send(id::MsgTypeSolenoidDriver::Target, payload);
 }
 
-void SolenoidDriverClient::set_target(const std::array<bool, 8>& target)
+bool SolenoidDriverClient::set_target(const std::array<bool, 8>& target)
 {
     uint8_t data = 0;
     for (int i = 0; i < 8; i++) {
         data |= static_cast<uint8_t>(target[i]) << i;
     }
-    set_target(data);
+    return set_target(data);
 }
 
-void SolenoidDriverClient::on_receive(const CANFrame&) {}
-
 }  // namespace devices
 }  // namespace gn10_can
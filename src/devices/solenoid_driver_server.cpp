@@ -5,9 +5,19 @@
 namespace gn10_can {
 namespace devices {
 
-SolenoidDriverServer::SolenoidDriverServer(CANBus& bus, uint8_t dev_id)
+constexpr SolenoidDriverServer::CommandTable SolenoidDriverServer::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeSolenoidDriver::Init)] =
+        command_handler<SolenoidDriverServer, &SolenoidDriverServer::handle_init>;
+    table[command_index(id::MsgTypeSolenoidDriver::Target)] =
+        command_handler<SolenoidDriverServer, &SolenoidDriverServer::handle_target>;
+    return table;
+}();
+
+SolenoidDriverServer::SolenoidDriverServer(ICANBus& bus, uint8_t dev_id)
     : CANDevice(bus, id::DeviceType::SolenoidDriver, dev_id)
 {
+    set_command_table(COMMAND_TABLE);
 }
 
 bool SolenoidDriverServer::get_new_init()
@@ -39,20 +49,23 @@ bool SolenoidDriverServer::get_new_target(std::array<bool, 8>& target)
     return true;
 }
 
-void SolenoidDriverServer::on_receive(const CANFrame& frame)
+void SolenoidDriverServer::handle_init(const CANFrame& frame)
+{
+    uint8_t value;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, value)) {
+        init_ = value;
+    } else {
+        count_parse_failure();
+    }
+}
+
+void SolenoidDriverServer::handle_target(const CANFrame& frame)
 {
-    auto id_fields = id::unpack(frame.id);
-
-    if (id_fields.is_command(id::MsgTypeSolenoidDriver::Init)) {
-        uint8_t value;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, value)) {
-            init_ = value;
-        }
-    } else if (id_fields.is_command(id::MsgTypeSolenoidDriver::Target)) {
-        uint8_t value;
-        if (converter::unpack(frame.data.data(), frame.dlc, 0, value)) {
-            target_ = value;
-        }
+    uint8_t value;
+    if (converter::unpack(frame.data.data(), frame.dlc, 0, value)) {
+        target_ = value;
+    } else {
+        count_parse_failure();
     }
 }
 
@@ -0,0 +1,94 @@
+#include "hal_stub.hpp"
+
+#include <cstring>
+
+namespace hal_stub {
+
+namespace {
+
+/**
+ * @brief DLCコードのデータ長（HAL と同じく、コードから転送するバイト数を決める）
+ *
+ */
+constexpr std::array<uint8_t, 16> DLC_TO_BYTES = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64
+};
+
+FDCANState state;
+
+}  // namespace
+
+FDCANState& fdcan_state()
+{
+    return state;
+}
+
+void reset()
+{
+    state = FDCANState{};
+}
+
+}  // namespace hal_stub
+
+using hal_stub::DLC_TO_BYTES;
+using hal_stub::state;
+
+HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef*, FDCAN_FilterTypeDef*)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_ConfigGlobalFilter(
+    FDCAN_HandleTypeDef*, uint32_t, uint32_t, uint32_t, uint32_t
+)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_Start(FDCAN_HandleTypeDef*)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_Stop(FDCAN_HandleTypeDef*)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_ActivateNotification(FDCAN_HandleTypeDef*, uint32_t, uint32_t)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_AddMessageToTxFifoQ(
+    FDCAN_HandleTypeDef*, FDCAN_TxHeaderTypeDef* tx_header, uint8_t* tx_data
+)
+{
+    if (tx_header->DataLength > FDCAN_DLC_BYTES_64) {
+        return HAL_ERROR;
+    }
+    state.last_tx_header = *tx_header;
+    state.last_tx_data.fill(0);
+    std::memcpy(state.last_tx_data.data(), tx_data, DLC_TO_BYTES[tx_header->DataLength]);
+    state.tx_count++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(
+    FDCAN_HandleTypeDef*, uint32_t, FDCAN_RxHeaderTypeDef* rx_header, uint8_t* rx_data
+)
+{
+    if (state.rx_fifo.empty()) {
+        return HAL_ERROR;
+    }
+    const hal_stub::RxMessage& message = state.rx_fifo.front();
+    *rx_header                         = message.header;
+    std::memcpy(rx_data, message.data.data(), DLC_TO_BYTES[message.header.DataLength & 0xF]);
+    state.rx_fifo.pop_front();
+    return HAL_OK;
+}
+
+uint16_t HAL_FDCAN_GetTimestampCounter(FDCAN_HandleTypeDef*)
+{
+    return state.timestamp_counter;
+}
@@ -0,0 +1,48 @@
+/**
+ * @brief HAL スタブの呼び出し記録と受信メッセージのキュー（テストから参照する）
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+
+#include "main.h"
+
+namespace hal_stub {
+
+/**
+ * @brief スタブの受信FIFOに積むメッセージ
+ *
+ */
+struct RxMessage {
+    FDCAN_RxHeaderTypeDef header{};
+    std::array<uint8_t, 64> data{};
+};
+
+/**
+ * @brief スタブの状態
+ *
+ */
+struct FDCANState {
+    FDCAN_TxHeaderTypeDef last_tx_header{};  // 最後に送信したヘッダ
+    std::array<uint8_t, 64> last_tx_data{};  // 最後に送信したデータ（DataLength の長さだけ）
+    uint32_t tx_count = 0;                   // 送信したメッセージ数
+    std::deque<RxMessage> rx_fifo;           // HAL_FDCAN_GetRxMessage() が返すメッセージ
+    uint16_t timestamp_counter = 0;          // HAL_FDCAN_GetTimestampCounter() の値
+};
+
+/**
+ * @brief スタブの状態を取得する
+ *
+ * @return FDCANState& 全ハンドル共通の状態
+ */
+FDCANState& fdcan_state();
+
+/**
+ * @brief スタブの状態を初期化する
+ *
+ */
+void reset();
+
+}  // namespace hal_stub
@@ -0,0 +1,121 @@
+/**
+ * @brief STM32 HAL の FDCAN 部分を Linux でビルドするためのスタブ
+ *
+ * drivers/stm32_fdcan が使う型・定数・関数だけを、STM32G4 HAL と同じ名前で宣言します。
+ * FDCAN_DLC_BYTES_n は G4 と同じく DLCコードそのものです。
+ */
+#pragma once
+
+#include <cstdint>
+
+typedef enum { HAL_OK = 0x00U, HAL_ERROR = 0x01U } HAL_StatusTypeDef;
+
+typedef struct {
+    uint32_t StdFiltersNbr;
+} FDCAN_InitTypeDef;
+
+typedef struct {
+    FDCAN_InitTypeDef Init;
+} FDCAN_HandleTypeDef;
+
+typedef struct {
+    uint32_t IdType;
+    uint32_t FilterIndex;
+    uint32_t FilterType;
+    uint32_t FilterConfig;
+    uint32_t FilterID1;
+    uint32_t FilterID2;
+} FDCAN_FilterTypeDef;
+
+typedef struct {
+    uint32_t Identifier;
+    uint32_t IdType;
+    uint32_t TxFrameType;
+    uint32_t DataLength;
+    uint32_t ErrorStateIndicator;
+    uint32_t BitRateSwitch;
+    uint32_t FDFormat;
+    uint32_t TxEventFifoControl;
+    uint32_t MessageMarker;
+} FDCAN_TxHeaderTypeDef;
+
+typedef struct {
+    uint32_t Identifier;
+    uint32_t IdType;
+    uint32_t RxFrameType;
+    uint32_t DataLength;
+    uint32_t ErrorStateIndicator;
+    uint32_t BitRateSwitch;
+    uint32_t FDFormat;
+    uint32_t RxTimestamp;
+    uint32_t FilterIndex;
+    uint32_t IsFilterMatchingFrame;
+} FDCAN_RxHeaderTypeDef;
+
+#define FDCAN_STANDARD_ID 0x00000000U
+#define FDCAN_EXTENDED_ID 0x40000000U
+
+#define FDCAN_DATA_FRAME   0x00000000U
+#define FDCAN_REMOTE_FRAME 0x20000000U
+
+#define FDCAN_DLC_BYTES_0  0x00000000U
+#define FDCAN_DLC_BYTES_1  0x00000001U
+#define FDCAN_DLC_BYTES_2  0x00000002U
+#define FDCAN_DLC_BYTES_3  0x00000003U
+#define FDCAN_DLC_BYTES_4  0x00000004U
+#define FDCAN_DLC_BYTES_5  0x00000005U
+#define FDCAN_DLC_BYTES_6  0x00000006U
+#define FDCAN_DLC_BYTES_7  0x00000007U
+#define FDCAN_DLC_BYTES_8  0x00000008U
+#define FDCAN_DLC_BYTES_12 0x00000009U
+#define FDCAN_DLC_BYTES_16 0x0000000AU
+#define FDCAN_DLC_BYTES_20 0x0000000BU
+#define FDCAN_DLC_BYTES_24 0x0000000CU
+#define FDCAN_DLC_BYTES_32 0x0000000DU
+#define FDCAN_DLC_BYTES_48 0x0000000EU
+#define FDCAN_DLC_BYTES_64 0x0000000FU
+
+#define FDCAN_ESI_ACTIVE  0x00000000U
+#define FDCAN_ESI_PASSIVE 0x80000000U
+
+#define FDCAN_BRS_OFF 0x00000000U
+#define FDCAN_BRS_ON  0x00100000U
+
+#define FDCAN_CLASSIC_CAN 0x00000000U
+#define FDCAN_FD_CAN      0x00200000U
+
+#define FDCAN_NO_TX_EVENTS 0x00000000U
+
+#define FDCAN_FILTER_MASK       0x00000002U
+#define FDCAN_FILTER_DISABLE    0x00000000U
+#define FDCAN_FILTER_TO_RXFIFO0 0x00000001U
+
+#define FDCAN_REJECT        0x00000002U
+#define FDCAN_REJECT_REMOTE 0x00000001U
+
+#define FDCAN_RX_FIFO0                0x00000040U
+#define FDCAN_IT_RX_FIFO0_NEW_MESSAGE 0x00000001U
+
+HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef* hfdcan, FDCAN_FilterTypeDef* config);
+HAL_StatusTypeDef HAL_FDCAN_ConfigGlobalFilter(
+    FDCAN_HandleTypeDef* hfdcan,
+    uint32_t non_matching_std,
+    uint32_t non_matching_ext,
+    uint32_t reject_remote_std,
+    uint32_t reject_remote_ext
+);
+HAL_StatusTypeDef HAL_FDCAN_Start(FDCAN_HandleTypeDef* hfdcan);
+HAL_StatusTypeDef HAL_FDCAN_Stop(FDCAN_HandleTypeDef* hfdcan);
+HAL_StatusTypeDef HAL_FDCAN_ActivateNotification(
+    FDCAN_HandleTypeDef* hfdcan, uint32_t active_its, uint32_t buffer_indexes
+);
+HAL_StatusTypeDef HAL_FDCAN_AddMessageToTxFifoQ(
+    FDCAN_HandleTypeDef* hfdcan, FDCAN_TxHeaderTypeDef* tx_header, uint8_t* tx_data
+);
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(
+    FDCAN_HandleTypeDef* hfdcan,
+    uint32_t rx_location,
+    FDCAN_RxHeaderTypeDef* rx_header,
+    uint8_t* rx_data
+);
+uint16_t HAL_FDCAN_GetTimestampCounter(FDCAN_HandleTypeDef* hfdcan);
@@ -1,20 +1,36 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <queue>
 #include <vector>
 
 #include "gn10_can/drivers/can_driver_interface.hpp"
+#include "gn10_can/drivers/fdcan_driver_interface.hpp"
 
-class MockDriver : public gn10_can::drivers::ICANDriver
+template <typename Frame, typename Interface>
+class BasicMockDriver : public Interface
 {
 public:
-    bool send(const gn10_can::CANFrame& frame) override
+    bool send(const Frame& frame) override
     {
+        if (!accept_send) {
+            return false;
+        }
         sent_frames.push_back(frame);
         return true;
     }
 
-    bool receive(gn10_can::CANFrame& out_frame) override
+    std::size_t send_batch(const Frame* frames, std::size_t count) override
+    {
+        send_batch_calls++;
+        if (count > batch_limit) {
+            count = batch_limit;
+        }
+        return Interface::send_batch(frames, count);
+    }
+
+    bool receive(Frame& out_frame) override
     {
         if (receive_queue.empty()) {
             return false;
@@ -24,12 +40,66 @@ public:
         return true;
     }
 
+    std::size_t receive_batch(Frame* out_frames, std::size_t max_frames) override
+    {
+        receive_batch_calls++;
+        std::size_t received = 0;
+        while (received < max_frames && !receive_queue.empty()) {
+            out_frames[received++] = receive_queue.front();
+            receive_queue.pop();
+        }
+        return received;
+    }
+
+    std::size_t peek_receive(Frame*& out_frames) override
+    {
+        out_frames = nullptr;
+        if (!zero_copy || receive_queue.empty()) {
+            return 0;
+        }
+        out_frames = &receive_queue.front();  // std::queue は先頭の1フレームだけ連続している
+        return 1;
+    }
+
+    void release_receive(std::size_t count) override
+    {
+        release_calls++;
+        for (std::size_t i = 0; i < count; ++i) {
+            receive_queue.pop();
+        }
+    }
+
+    std::size_t max_acceptance_filters() const override
+    {
+        return max_filters;
+    }
+
+    bool set_acceptance_filters(const gn10_can::AcceptanceFilter* filters, std::size_t count) override
+    {
+        if (count == 0 || count > max_filters) {
+            return false;
+        }
+        acceptance_filters.assign(filters, filters + count);
+        return true;
+    }
+
     // Helper methods for testing
-    void push_receive_frame(const gn10_can::CANFrame& frame)
+    void push_receive_frame(const Frame& frame)
     {
         receive_queue.push(frame);
     }
 
-    std::vector<gn10_can::CANFrame> sent_frames;
-    std::queue<gn10_can::CANFrame> receive_queue;
+    std::vector<Frame> sent_frames;
+    std::queue<Frame> receive_queue;
+    bool accept_send                = true;   // false にすると送信メールボックス満杯を模擬する
+    bool zero_copy                  = false;  // true にすると受信キュー上のフレームを直接配送させる
+    std::size_t send_batch_calls    = 0;
+    std::size_t batch_limit         = SIZE_MAX;  // 1度の send_batch() で受け付けるフレーム数の上限
+    std::size_t receive_batch_calls = 0;
+    std::size_t release_calls       = 0;
+    std::size_t max_filters         = 0;  // 0 の場合は受信フィルタ未対応として振る舞う
+    std::vector<gn10_can::AcceptanceFilter> acceptance_filters;
 };
+
+using MockDriver   = BasicMockDriver<gn10_can::CANFrame, gn10_can::drivers::ICANDriver>;
+using MockFDDriver = BasicMockDriver<gn10_can::FDCANFrame, gn10_can::drivers::IFDCANDriver>;
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gn10_can/core/acceptance_filter.hpp"
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+uint32_t routing_id_of(id::DeviceType type, uint8_t dev_id)
+{
+    return (static_cast<uint32_t>(type) << id::BIT_WIDTH_DEV_ID) | dev_id;
+}
+
+bool any_accepts(const std::vector<AcceptanceFilter>& filters, uint32_t std_id)
+{
+    for (const AcceptanceFilter& filter : filters) {
+        if (filter.accepts(std_id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<AcceptanceFilter> build(const std::vector<uint32_t>& routing_ids, std::size_t budget)
+{
+    std::vector<AcceptanceFilter> filters(budget);
+    std::size_t count =
+        build_acceptance_filters(routing_ids.data(), routing_ids.size(), filters.data(), budget);
+    filters.resize(count);
+    return filters;
+}
+
+class PlainDevice : public CANDevice
+{
+public:
+    PlainDevice(ICANBus& bus, id::DeviceType type, uint8_t dev_id) : CANDevice(bus, type, dev_id) {}
+
+    void on_receive(const CANFrame&) override {}
+};
+
+}  // namespace
+
+TEST(AcceptanceFilterTest, ExactMatchWhenBudgetAllows)
+{
+    std::vector<uint32_t> routing_ids = {
+        routing_id_of(id::DeviceType::MotorDriver, 1),
+        routing_id_of(id::DeviceType::MotorDriver, 1),  // 重複は1つにまとめる
+        routing_id_of(id::DeviceType::ServoMotor, 3),
+    };
+    std::vector<AcceptanceFilter> filters = build(routing_ids, 4);
+    ASSERT_EQ(filters.size(), 2);
+
+    for (uint32_t std_id = 0; std_id < 0x800; ++std_id) {
+        uint32_t routing_id = std_id >> id::BIT_WIDTH_COMMAND;
+        bool expected       = (routing_id == routing_ids[0] || routing_id == routing_ids[2]);
+        EXPECT_EQ(any_accepts(filters, std_id), expected) << std::hex << std_id;
+    }
+}
+
+TEST(AcceptanceFilterTest, ZeroBudgetProducesNothing)
+{
+    std::vector<uint32_t> routing_ids = {1, 2, 3};
+    EXPECT_EQ(build_acceptance_filters(routing_ids.data(), routing_ids.size(), nullptr, 0), 0);
+}
+
+TEST(AcceptanceFilterTest, CoversAllRoutingIdsWithinBudget)
+{
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<uint32_t> routing_dist(0, 255);
+
+    for (int trial = 0; trial < 200; ++trial) {
+        std::size_t device_count = 1 + trial % 16;
+        std::size_t budget       = 1 + trial % 5;
+
+        std::vector<uint32_t> routing_ids;
+        for (std::size_t i = 0; i < device_count; ++i) {
+            routing_ids.push_back(routing_dist(rng));
+        }
+        std::vector<AcceptanceFilter> filters = build(routing_ids, budget);
+
+        EXPECT_LE(filters.size(), budget);
+        for (uint32_t routing_id : routing_ids) {
+            for (uint32_t command = 0; command < (1u << id::BIT_WIDTH_COMMAND); ++command) {
+                EXPECT_TRUE(any_accepts(filters, (routing_id << id::BIT_WIDTH_COMMAND) | command));
+            }
+        }
+    }
+}
+
+TEST(AcceptanceFilterTest, ReducesFalseAcceptsOnTrafficMix)
+{
+    // ソレノイドドライバー1台と非常停止だけを受信したいノード
+    std::vector<uint32_t> routing_ids = {
+        routing_id_of(id::DeviceType::SolenoidDriver, 0),
+        routing_id_of(id::DeviceType::EmergencyStop, 0),
+    };
+
+    // 合成トラフィック: モーター8台・サーボ4台・ソレノイド2台・非常停止の全コマンド
+    std::vector<uint32_t> traffic;
+    auto add_traffic = [&](id::DeviceType type, uint8_t count) {
+        for (uint8_t dev_id = 0; dev_id < count; ++dev_id) {
+            for (uint32_t command = 0; command < (1u << id::BIT_WIDTH_COMMAND); ++command) {
+                traffic.push_back(
+                    (routing_id_of(type, dev_id) << id::BIT_WIDTH_COMMAND) | command
+                );
+            }
+        }
+    };
+    add_traffic(id::DeviceType::MotorDriver, 8);
+    add_traffic(id::DeviceType::ServoMotor, 4);
+    add_traffic(id::DeviceType::SolenoidDriver, 2);
+    add_traffic(id::DeviceType::EmergencyStop, 1);
+
+    auto count_false_accepts = [&](const std::vector<AcceptanceFilter>& filters) {
+        std::size_t false_accepts = 0;
+        for (uint32_t std_id : traffic) {
+            uint32_t routing_id = std_id >> id::BIT_WIDTH_COMMAND;
+            bool wanted = (routing_id == routing_ids[0] || routing_id == routing_ids[1]);
+            if (!wanted && any_accepts(filters, std_id)) {
+                false_accepts++;
+            }
+        }
+        return false_accepts;
+    };
+
+    std::vector<AcceptanceFilter> accept_all(1);  // 従来の init() と同じ全受信
+    std::size_t baseline = count_false_accepts(accept_all);
+    EXPECT_EQ(baseline, traffic.size() - 2 * (1u << id::BIT_WIDTH_COMMAND));
+
+    EXPECT_EQ(count_false_accepts(build(routing_ids, 2)), 0);
+
+    // バンクが1つしかなくても、全受信より誤受信は減る
+    std::size_t single_bank = count_false_accepts(build(routing_ids, 1));
+    EXPECT_LT(single_bank, baseline);
+}
+
+TEST(AcceptanceFilterTest, BusAppliesFiltersForAttachedDevices)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    PlainDevice motor(bus, id::DeviceType::MotorDriver, 2);
+    PlainDevice servo(bus, id::DeviceType::ServoMotor, 0);
+
+    EXPECT_FALSE(bus.apply_acceptance_filters());  // フィルタ未対応のドライバー
+
+    driver.max_filters = 14;
+    ASSERT_TRUE(bus.apply_acceptance_filters());
+    ASSERT_EQ(driver.acceptance_filters.size(), 2);
+
+    uint32_t motor_target = id::pack(id::DeviceType::MotorDriver, 2, id::MsgTypeMotorDriver::Target);
+    uint32_t other_motor  = id::pack(id::DeviceType::MotorDriver, 3, id::MsgTypeMotorDriver::Target);
+    EXPECT_TRUE(any_accepts(driver.acceptance_filters, motor_target));
+    EXPECT_FALSE(any_accepts(driver.acceptance_filters, other_motor));
+}
+
+TEST(AcceptanceFilterTest, BusKeepsFiltersWithoutDevices)
+{
+    MockDriver driver;
+    driver.max_filters = 14;
+    driver.acceptance_filters.push_back(AcceptanceFilter{0x000, 0x000});  // 全受信
+    CANBus bus(driver);
+
+    // デバイスが無い状態で全フレームを破棄する設定にはせず、既存のフィルタを残す
+    EXPECT_FALSE(bus.apply_acceptance_filters());
+    ASSERT_EQ(driver.acceptance_filters.size(), 1);
+    EXPECT_TRUE(driver.acceptance_filters[0].accepts(0x123));
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/drivers/buffered_driver.hpp"
+#include "gn10_can/utils/spsc_ring_buffer.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+TEST(SPSCRingBufferTest, PushPopInOrder)
+{
+    utils::SPSCRingBuffer<int, 4> ring;
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    EXPECT_FALSE(ring.try_push(4));  // 満杯
+    EXPECT_EQ(ring.size(), 4);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.try_pop(value));
+}
+
+TEST(SPSCRingBufferTest, PeekReferencesSlotsUntilPop)
+{
+    utils::SPSCRingBuffer<int, 4> ring;
+    int* front = nullptr;
+    EXPECT_EQ(ring.peek(front), 0);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    ASSERT_EQ(ring.peek(front), 4);
+    EXPECT_EQ(front[0], 0);
+    EXPECT_EQ(front[3], 3);
+    EXPECT_FALSE(ring.try_push(4));  // 参照中のスロットは上書きされない
+
+    ring.pop(3);
+    EXPECT_TRUE(ring.try_push(4));
+    EXPECT_TRUE(ring.try_push(5));
+
+    // 末尾で折り返す場合は末尾までを参照する
+    ASSERT_EQ(ring.peek(front), 1);
+    EXPECT_EQ(front[0], 3);
+    ring.pop(1);
+    ASSERT_EQ(ring.peek(front), 2);
+    EXPECT_EQ(front[0], 4);
+    EXPECT_EQ(front[1], 5);
+}
+
+TEST(BufferedDriverTest, OverflowAndHighWaterMark)
+{
+    MockDriver hardware;
+    drivers::BufferedCANDriver<4> driver{hardware};
+
+    CANFrame frame;
+    for (uint32_t i = 0; i < 6; ++i) {
+        frame.id = i;
+        hardware.push_receive_frame(frame);
+    }
+
+    // 割り込みで6フレーム吸い出すが、リングは4段なので2フレーム溢れる
+    EXPECT_EQ(driver.on_rx_interrupt(), 4);
+    EXPECT_EQ(driver.overflow_count(), 2);
+    EXPECT_EQ(driver.high_water_mark(), 4);
+    EXPECT_TRUE(hardware.receive_queue.empty());
+
+    CANFrame out;
+    EXPECT_TRUE(driver.receive(out));
+    EXPECT_EQ(out.id, 0);
+    EXPECT_EQ(driver.pending(), 3);
+}
+
+TEST(BufferedDriverTest, SendIsForwarded)
+{
+    MockDriver hardware;
+    drivers::BufferedCANDriver<4> driver{hardware};
+
+    CANFrame frame;
+    frame.id = 0x123;
+    EXPECT_TRUE(driver.send(frame));
+    ASSERT_EQ(hardware.sent_frames.size(), 1);
+    EXPECT_EQ(hardware.sent_frames[0].id, 0x123);
+}
+
+namespace {
+
+class SequenceDevice : public CANDevice
+{
+public:
+    SequenceDevice(ICANBus& bus, uint8_t id) : CANDevice(bus, id::DeviceType::MotorDriver, id) {}
+
+    void on_receive(const CANFrame& frame) override
+    {
+        uint32_t sequence = 0;
+        for (int i = 0; i < 4; ++i) {
+            sequence |= static_cast<uint32_t>(frame.data[i]) << (8 * i);
+        }
+        if (sequence != expected_sequence) {
+            out_of_order++;
+        }
+        expected_sequence = sequence + 1;
+        received++;
+    }
+
+    uint32_t expected_sequence = 0;
+    uint32_t out_of_order      = 0;
+    uint32_t received          = 0;
+};
+
+}  // namespace
+
+TEST(BufferedDriverTest, ProducerThreadStandsInForIsr)
+{
+    constexpr uint32_t FRAME_COUNT = 20000;
+
+    MockDriver hardware;
+    drivers::BufferedCANDriver<64> driver{hardware};
+    CANBus bus{driver};
+    SequenceDevice device(bus, 1);
+
+    // 受信割り込みの代わりに別スレッドからフレームを積む
+    std::thread producer([&driver, &device]() {
+        CANFrame frame;
+        frame.id  = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+        frame.dlc = 4;
+        for (uint32_t sequence = 0; sequence < FRAME_COUNT; ++sequence) {
+            for (int i = 0; i < 4; ++i) {
+                frame.data[i] = static_cast<uint8_t>(sequence >> (8 * i));
+            }
+            while (!driver.push_from_isr(frame)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // メインループ側は update() で吸い出すだけ
+    while (device.received < FRAME_COUNT) {
+        if (bus.update(64).processed_frames == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(device.received, FRAME_COUNT);
+    EXPECT_EQ(device.out_of_order, 0);
+    EXPECT_LE(driver.high_water_mark(), 64);
+}
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include "gn10_can/core/bus_load.hpp"
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/core/frame_cost.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+using frame_cost::Stuffing;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+// Stuffing::None で 111bit (= 1Mbit/s で 111us) になる標準ID・8byteのフレーム
+CANFrame make_frame(uint32_t routing_id)
+{
+    CANFrame frame;
+    frame.id                     = routing_id << 3;
+    std::array<uint8_t, 8> bytes = {1, 2, 3, 4, 5, 6, 7, 8};
+    frame.set_data(bytes.data(), bytes.size());
+    return frame;
+}
+
+BusLoadConfig make_config(Stuffing stuffing)
+{
+    BusLoadConfig config;
+    config.nominal_bitrate = 1000000;
+    config.slot_us         = 10000;
+    config.stuffing        = stuffing;
+    return config;
+}
+
+}  // namespace
+
+TEST(FrameCostTest, ClassicWorstCaseMatchesStandardFormula)
+{
+    std::array<uint8_t, 8> data{};
+    // 標準ID: 98bit + 最悪スタッフ (98 - 1) / 4 = 24bit + 13bit
+    EXPECT_EQ(
+        frame_cost::classic_bits(0x123, false, data.data(), 8, Stuffing::WorstCase).nominal_bits,
+        135
+    );
+    // 拡張ID: 118bit + 29bit + 13bit
+    EXPECT_EQ(
+        frame_cost::classic_bits(0x123, true, data.data(), 8, Stuffing::WorstCase).nominal_bits,
+        160
+    );
+    EXPECT_EQ(
+        frame_cost::classic_bits(0x123, false, data.data(), 8, Stuffing::None).nominal_bits, 111
+    );
+}
+
+TEST(FrameCostTest, ClassicActualStuffingCountsRuns)
+{
+    // ID 0・DLC 0 はCRCも0になり、34bit の0が続くため5bitごとにスタッフビットが入る
+    frame_cost::BitCount bits = frame_cost::classic_bits(0, false, nullptr, 0, Stuffing::Actual);
+    EXPECT_EQ(bits.nominal_bits, 34 + 6 + 13);
+    EXPECT_EQ(bits.data_bits, 0);
+
+    // 実際のスタッフビットは0以上、最悪値以下
+    std::array<uint8_t, 8> patterns[] = {
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+        {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA},
+        {0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0x78, 0x3C, 0x1E},
+    };
+    for (const auto& data : patterns) {
+        for (uint32_t id : {0x000u, 0x7FFu, 0x155u}) {
+            uint32_t none =
+                frame_cost::classic_bits(id, false, data.data(), 8, Stuffing::None).nominal_bits;
+            uint32_t actual =
+                frame_cost::classic_bits(id, false, data.data(), 8, Stuffing::Actual).nominal_bits;
+            uint32_t worst =
+                frame_cost::classic_bits(id, false, data.data(), 8, Stuffing::WorstCase)
+                    .nominal_bits;
+            EXPECT_GE(actual, none);
+            EXPECT_LE(actual, worst);
+        }
+    }
+}
+
+TEST(FrameCostTest, FdSplitsPhasesAtBitRateSwitch)
+{
+    std::array<uint8_t, 64> data{};
+    // 調停: SOF + ID 11 + RRS + IDE + FDF + res + BRS = 17bit、最後に13bit
+    // データ: ESI + DLC 4 + 512 + スタッフカウント 4 + CRC21 + 固定スタッフ 7
+    frame_cost::BitCount brs =
+        frame_cost::fd_bits(0x123, false, data.data(), 64, true, Stuffing::None);
+    EXPECT_EQ(brs.nominal_bits, 17 + 13);
+    EXPECT_EQ(brs.data_bits, 1 + 4 + 512 + 4 + 21 + 7);
+
+    frame_cost::BitCount no_brs =
+        frame_cost::fd_bits(0x123, false, data.data(), 64, false, Stuffing::None);
+    EXPECT_EQ(no_brs.nominal_bits, brs.nominal_bits + brs.data_bits);
+    EXPECT_EQ(no_brs.data_bits, 0);
+
+    // 16byte 以下は CRC17（固定スタッフ 6bit）
+    frame_cost::BitCount small =
+        frame_cost::fd_bits(0x123, false, data.data(), 8, true, Stuffing::None);
+    EXPECT_EQ(small.data_bits, 1 + 4 + 64 + 4 + 17 + 6);
+
+    // 10byte は 12byte に詰め物をして送られる
+    EXPECT_EQ(
+        frame_cost::fd_bits(0x123, false, data.data(), 10, true, Stuffing::None).data_bits,
+        frame_cost::fd_bits(0x123, false, data.data(), 12, true, Stuffing::None).data_bits
+    );
+}
+
+TEST(FrameCostTest, FdPaddedLength)
+{
+    EXPECT_EQ(frame_cost::fd_padded_length(0), 0);
+    EXPECT_EQ(frame_cost::fd_padded_length(8), 8);
+    EXPECT_EQ(frame_cost::fd_padded_length(9), 12);
+    EXPECT_EQ(frame_cost::fd_padded_length(13), 16);
+    EXPECT_EQ(frame_cost::fd_padded_length(24), 24);
+    EXPECT_EQ(frame_cost::fd_padded_length(25), 32);
+    EXPECT_EQ(frame_cost::fd_padded_length(33), 48);
+    EXPECT_EQ(frame_cost::fd_padded_length(49), 64);
+}
+
+TEST(FrameCostTest, DurationUsesBothBitrates)
+{
+    frame_cost::BitCount classic;
+    classic.nominal_bits = 135;
+    EXPECT_EQ(frame_cost::duration_ns(classic, 1000000, 0), 135000);
+    EXPECT_EQ(frame_cost::duration_ns(classic, 500000, 0), 270000);
+
+    frame_cost::BitCount fd;
+    fd.nominal_bits = 30;
+    fd.data_bits    = 549;
+    EXPECT_EQ(frame_cost::duration_ns(fd, 1000000, 5000000), 30000 + 109800);
+    EXPECT_EQ(frame_cost::duration_ns(fd, 0, 5000000), 0);
+}
+
+TEST(BusLoadTest, MeasuresUtilizationOverSlidingWindow)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    bus.set_time_source(fake_time_source);
+    CANBusLoadEstimator<> load(make_config(Stuffing::None));
+    bus.add_tap(load);
+
+    // 1ms ごとに 111us のフレーム → 11.1%
+    for (uint32_t i = 0; i < 100; ++i) {
+        fake_now_us = 100000 + i * 1000;
+        driver.push_receive_frame(make_frame(1));
+        bus.update();
+    }
+    EXPECT_NEAR(load.utilization(199500), 0.111f, 0.001f);
+    EXPECT_NEAR(load.utilization(200000), 0.111f, 0.001f);
+
+    // 送信も数える
+    fake_now_us = 200000;
+    EXPECT_TRUE(bus.send_frame(make_frame(1)));
+    EXPECT_GT(load.utilization(200000), 0.111f);
+
+    // 窓より古い区間は数えない
+    EXPECT_FLOAT_EQ(load.utilization(400000), 0.0f);
+
+    // 長い空白の後も新しい区間から積み直す
+    fake_now_us = 1000000;
+    driver.push_receive_frame(make_frame(1));
+    bus.update();
+    EXPECT_NEAR(load.utilization(1000000 + 9 * 10000), 111.0f / 90000.0f, 0.0001f);
+}
+
+TEST(BusLoadTest, TracksRoutesSeparately)
+{
+    CANBusLoadEstimator<2> load(make_config(Stuffing::None));
+
+    for (uint32_t i = 0; i < 30; ++i) {
+        load.on_frame(make_frame(5), TapDirection::Rx, 1000 + i * 1000);
+        if (i % 3 == 0) {
+            load.on_frame(make_frame(9), TapDirection::Tx, 1000 + i * 1000);
+        }
+    }
+    load.on_frame(make_frame(12), TapDirection::Rx, 31000);
+
+    ASSERT_EQ(load.route_count(), 2);
+    EXPECT_EQ(load.route_id(0), 5);
+    EXPECT_EQ(load.route_id(1), 9);
+    EXPECT_EQ(load.untracked_frames(), 1);
+
+    float route5 = load.utilization(5, 31000);
+    float route9 = load.utilization(9, 31000);
+    EXPECT_NEAR(route5, 3.0f * route9, 0.0001f);
+    EXPECT_FLOAT_EQ(load.utilization(12, 31000), 0.0f);
+    // 記録できなかったルーティングIDもバス全体には含まれる
+    EXPECT_NEAR(load.utilization(31000), route5 + route9 + route9 / 10.0f, 0.0001f);
+}
+
+TEST(BusLoadTest, ReportsPeakSlot)
+{
+    CANBusLoadEstimator<> load(make_config(Stuffing::None));
+
+    // 1区間 (10ms) に 45 フレーム集中 → その区間は 49.95%
+    for (uint32_t i = 0; i < 45; ++i) {
+        load.on_frame(make_frame(1), TapDirection::Rx, 20000 + i * 100);
+    }
+    load.on_frame(make_frame(1), TapDirection::Rx, 50000);
+
+    EXPECT_NEAR(load.peak_slot_utilization(55000), 0.4995f, 0.0001f);
+    EXPECT_LT(load.utilization(55000), load.peak_slot_utilization(55000));
+}
+
+TEST(BusLoadTest, FdFramesUseDataBitrate)
+{
+    BusLoadConfig config = make_config(Stuffing::None);
+    config.data_bitrate  = 5000000;
+    FDCANBusLoadEstimator<> load(config);
+
+    FDCANFrame frame;
+    frame.id              = 0x123;
+    frame.bit_rate_switch = true;
+    std::array<uint8_t, 64> bytes{};
+    frame.set_data(bytes.data(), bytes.size());
+    load.on_frame(frame, TapDirection::Rx, 10000);
+
+    // 30bit @ 1Mbit/s + 549bit @ 5Mbit/s = 139.8us を 10ms の区間で
+    EXPECT_NEAR(load.peak_slot_utilization(15000), 0.01398f, 0.00001f);
+}
+
+TEST(BusLoadTest, FdFramesWithoutBrsUseNominalBitrate)
+{
+    BusLoadConfig config = make_config(Stuffing::None);
+    config.data_bitrate  = 5000000;
+    FDCANBusLoadEstimator<> load(config);
+
+    FDCANFrame frame;
+    frame.id = 0x123;
+    std::array<uint8_t, 64> bytes{};
+    frame.set_data(bytes.data(), bytes.size());
+    load.on_frame(frame, TapDirection::Rx, 10000);
+
+    uint32_t expected_ns = frame_cost::duration_ns(
+        frame_cost::fd_bits(0x123, false, bytes.data(), 64, false, Stuffing::None), 1000000, 0
+    );
+    EXPECT_NEAR(load.peak_slot_utilization(15000), expected_ns / 10000000.0f, 0.00001f);
+}
+
+TEST(BusLoadTest, ClassicFramesOnFdBusUseClassicFormat)
+{
+    BusLoadConfig config = make_config(Stuffing::None);
+    FDCANBusLoadEstimator<> load(config);
+
+    FDCANFrame frame;
+    frame.id    = 0x123;
+    frame.is_fd = false;
+    std::array<uint8_t, 8> bytes{};
+    frame.set_data(bytes.data(), bytes.size());
+    load.on_frame(frame, TapDirection::Rx, 10000);
+
+    uint32_t expected_ns = frame_cost::duration_ns(
+        frame_cost::classic_bits(0x123, false, bytes.data(), 8, Stuffing::None), 1000000, 0
+    );
+    EXPECT_NEAR(load.peak_slot_utilization(15000), expected_ns / 10000000.0f, 0.00001f);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+struct TapRecord {
+    uint32_t id;
+    TapDirection direction;
+    TimestampUs timestamp_us;
+};
+
+template <typename Frame>
+class RecordingTap : public BasicTap<Frame>
+{
+public:
+    void on_frame(const Frame& frame, TapDirection direction, TimestampUs timestamp_us) override
+    {
+        records.push_back(TapRecord{frame.id, direction, timestamp_us});
+    }
+
+    std::vector<TapRecord> records;
+};
+
+CANFrame make_frame(uint32_t id)
+{
+    CANFrame frame;
+    frame.id = id;
+    return frame;
+}
+
+}  // namespace
+
+TEST(BusTapTest, SeesRoutedAndUnroutedRxFrames)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    devices::MotorDriverClient client(bus, 1);
+    RecordingTap<CANFrame> tap;
+    ASSERT_TRUE(bus.add_tap(tap));
+    fake_now_us = 42;
+    bus.set_time_source(fake_time_source);
+
+    CANFrame routed =
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback);
+    driver.push_receive_frame(routed);
+    driver.push_receive_frame(make_frame(0x7FF));  // 配送先なし
+    bus.update();
+
+    ASSERT_EQ(tap.records.size(), 2);
+    EXPECT_EQ(tap.records[0].id, routed.id);
+    EXPECT_EQ(tap.records[0].direction, TapDirection::Rx);
+    EXPECT_EQ(tap.records[0].timestamp_us, 42);
+    EXPECT_EQ(tap.records[1].id, 0x7FF);
+}
+
+TEST(BusTapTest, SeesTxFramesWhenHandedToDriver)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    RecordingTap<CANFrame> first;
+    RecordingTap<CANFrame> second;
+    bus.add_tap(first);
+    bus.add_tap(second);
+
+    bus.send_frame(make_frame(0x100));
+    driver.accept_send = false;
+    bus.send_frame(make_frame(0x200));  // キューに積まれただけでは通知しない
+    EXPECT_EQ(first.records.size(), 1);
+
+    driver.accept_send = true;
+    bus.flush();
+    ASSERT_EQ(first.records.size(), 2);
+    EXPECT_EQ(first.records[1].id, 0x200);
+    EXPECT_EQ(first.records[1].direction, TapDirection::Tx);
+    EXPECT_EQ(second.records.size(), 2);
+}
+
+TEST(BusTapTest, RemoveAndAutomaticDetach)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    RecordingTap<CANFrame> kept;
+    bus.add_tap(kept);
+    {
+        RecordingTap<CANFrame> scoped;
+        bus.add_tap(scoped);
+        EXPECT_FALSE(bus.add_tap(scoped));  // 二重登録は不可
+    }
+    RecordingTap<CANFrame> removed;
+    bus.add_tap(removed);
+    bus.remove_tap(removed);
+    EXPECT_FALSE(removed.is_attached());
+
+    bus.send_frame(make_frame(0x100));
+    EXPECT_EQ(kept.records.size(), 1);
+    EXPECT_TRUE(removed.records.empty());
+}
+
+TEST(BusTapTest, TapOutlivingBus)
+{
+    RecordingTap<FDCANFrame> tap;
+    {
+        MockFDDriver driver;
+        FDCANBus bus(driver);
+        bus.add_tap(tap);
+        EXPECT_TRUE(tap.is_attached());
+    }
+    EXPECT_FALSE(tap.is_attached());
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+
 #include "gn10_can/core/can_bus.hpp"
 #include "gn10_can/core/can_device.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/core/fdcan_device.hpp"
 #include "mock_driver.hpp"
 
 using namespace gn10_can;
@@ -9,7 +13,9 @@ using namespace gn10_can;
 class MockDevice : public CANDevice
 {
 public:
-    MockDevice(CANBus& bus, id::DeviceType type, uint8_t id) : CANDevice(bus, type, id) {}
+    MockDevice(ICANBus& bus, id::DeviceType type, uint8_t id) : CANDevice(bus, type, id) {}
+
+    using CANDevice::can_id;
 
     void on_receive(const CANFrame& frame) override
     {
@@ -29,13 +35,9 @@ protected:
 TEST_F(CANBusTest, RegisterDeviceAutomatic)
 {
     // RAII registration check
-    // Since attach/detach are private and automatic, we can only verify via side effects (like
-    // message reception) or by trusting the implementation. However, if we fail to register (e.g.
-    // max devices), we can't easily check bool. The current RAII design assumes enough capacity or
-    // handles failure silently (void).
-
-    // Check basic functionality
     MockDevice device1(bus, id::DeviceType::MotorDriver, 1);
+    EXPECT_TRUE(device1.is_attached());
+    EXPECT_EQ(bus.device_count(), 1);
 
     // Simulate frame reception
     CANFrame frame;
@@ -55,8 +57,10 @@ TEST_F(CANBusTest, RegisterMaxDevices)
         devices.push_back(std::make_unique<MockDevice>(bus, id::DeviceType::MotorDriver, i));
     }
 
-    // This extra device should fail to attach silently inside constructor
+    // The extra device fails to attach and reports it
     MockDevice extra_device(bus, id::DeviceType::MotorDriver, 100);
+    EXPECT_FALSE(extra_device.is_attached());
+    EXPECT_EQ(bus.device_count(), CANBus::MAX_DEVICES);
 
     // Verify extra_device does NOT receive messages
     CANFrame frame;
@@ -104,3 +108,636 @@ TEST_F(CANBusTest, SendFrame)
     ASSERT_EQ(driver.sent_frames.size(), 1);
     EXPECT_EQ(driver.sent_frames[0].id, 0x456);
 }
+
+TEST_F(CANBusTest, MultipleDevicesSameRoutingId)
+{
+    // Client と Sniffer のように同じルーティングIDに複数のデバイスを登録できる
+    MockDevice client(bus, id::DeviceType::MotorDriver, 3);
+    MockDevice sniffer(bus, id::DeviceType::MotorDriver, 3);
+    MockDevice other(bus, id::DeviceType::MotorDriver, 4);
+
+    CANFrame frame;
+    frame.id = client.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(client.received_frames.size(), 1);
+    EXPECT_EQ(sniffer.received_frames.size(), 1);
+    EXPECT_EQ(other.received_frames.size(), 0);
+}
+
+TEST_F(CANBusTest, DetachKeepsOtherDevicesOnSameRoutingId)
+{
+    MockDevice first(bus, id::DeviceType::ServoMotor, 2);
+    {
+        MockDevice second(bus, id::DeviceType::ServoMotor, 2);
+    }
+    MockDevice third(bus, id::DeviceType::ServoMotor, 2);
+
+    CANFrame frame;
+    frame.id = first.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(first.received_frames.size(), 1);
+    EXPECT_EQ(third.received_frames.size(), 1);
+}
+
+/**
+ * @brief 受信処理の中で、指定したデバイスを破棄するデバイス
+ *
+ */
+class DestroyingDevice : public MockDevice
+{
+public:
+    DestroyingDevice(ICANBus& bus, uint8_t id, std::unique_ptr<MockDevice>& victim)
+        : MockDevice(bus, id::DeviceType::ServoMotor, id), victim_(victim)
+    {
+    }
+
+    void on_receive(const CANFrame& frame) override
+    {
+        MockDevice::on_receive(frame);
+        victim_.reset();
+    }
+
+private:
+    std::unique_ptr<MockDevice>& victim_;
+};
+
+/**
+ * @brief 受信処理の中で自身を破棄するデバイス
+ *
+ */
+class SelfDestroyingDevice : public MockDevice
+{
+public:
+    SelfDestroyingDevice(ICANBus& bus, uint8_t id, std::unique_ptr<SelfDestroyingDevice>& owner)
+        : MockDevice(bus, id::DeviceType::ServoMotor, id), owner_(owner)
+    {
+    }
+
+    void on_receive(const CANFrame&) override
+    {
+        owner_.reset();  // 以降 this に触れない
+    }
+
+private:
+    std::unique_ptr<SelfDestroyingDevice>& owner_;
+};
+
+TEST_F(CANBusTest, HandlerMayDestroyTheNextDevice)
+{
+    std::unique_ptr<MockDevice> victim;
+    DestroyingDevice first(bus, 2, victim);
+    victim = std::make_unique<MockDevice>(bus, id::DeviceType::ServoMotor, 2);
+    MockDevice last(bus, id::DeviceType::ServoMotor, 2);
+
+    CANFrame frame;
+    frame.id = first.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(victim, nullptr);
+    EXPECT_EQ(first.received_frames.size(), 1);
+    EXPECT_EQ(last.received_frames.size(), 1);  // 破棄されたデバイスを飛ばして配送が続く
+}
+
+TEST_F(CANBusTest, HandlerMayDestroyItself)
+{
+    std::unique_ptr<SelfDestroyingDevice> device;
+    device = std::make_unique<SelfDestroyingDevice>(bus, 2, device);
+    MockDevice last(bus, id::DeviceType::ServoMotor, 2);
+
+    CANFrame frame;
+    frame.id = last.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(device, nullptr);
+    EXPECT_EQ(last.received_frames.size(), 2);
+    EXPECT_EQ(last.stats().rx_frames, 2);  // 破棄されたデバイスの統計は公開しない
+    EXPECT_EQ(bus.stats().rx_frames, 2);
+}
+
+TEST_F(CANBusTest, ExtendedIdOutOfRoutingRangeIsIgnored)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id          = 0x1FFFFFFF;
+    frame.is_extended = true;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(device.received_frames.size(), 0);
+}
+
+TEST(BasicBusTest, ConcreteDriverAndCapacity)
+{
+    // ドライバー型を具体的に指定したバスにも同じデバイスクラスを登録できる
+    MockDriver driver;
+    BasicBus<CANFrame, MockDriver, 2> bus{driver};
+    static_assert(decltype(bus)::MAX_DEVICES == 2, "capacity must follow the template argument");
+
+    MockDevice device1(bus, id::DeviceType::MotorDriver, 1);
+    MockDevice device2(bus, id::DeviceType::MotorDriver, 2);
+    MockDevice extra(bus, id::DeviceType::MotorDriver, 3);
+
+    CANFrame frame;
+    frame.id = device1.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    frame.id = extra.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(device1.received_frames.size(), 1);
+    EXPECT_EQ(device2.received_frames.size(), 0);
+    EXPECT_EQ(extra.received_frames.size(), 0);
+}
+
+class MockFDDevice : public FDCANDevice
+{
+public:
+    MockFDDevice(IFDCANBus& bus, id::DeviceType type, uint8_t id) : FDCANDevice(bus, type, id) {}
+
+    void on_receive(const FDCANFrame& frame) override
+    {
+        received_frames.push_back(frame);
+    }
+
+    std::vector<FDCANFrame> received_frames;
+};
+
+TEST(FDCANBusTest, DispatchAndSend)
+{
+    MockFDDriver driver;
+    FDCANBus bus{driver};
+    MockFDDevice device(bus, id::DeviceType::ESCHub, 1);
+
+    FDCANFrame frame;
+    frame.id  = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    frame.dlc = 64;
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    ASSERT_EQ(device.received_frames.size(), 1);
+    EXPECT_EQ(device.received_frames[0].dlc, 64);
+
+    EXPECT_TRUE(bus.send_frame(frame));
+    EXPECT_EQ(driver.sent_frames.size(), 1);
+}
+
+TEST_F(CANBusTest, UpdateWithFrameBudget)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    for (int i = 0; i < 5; ++i) {
+        driver.push_receive_frame(frame);
+    }
+
+    // 予算2フレームずつ処理し、残りは次回に持ち越される
+    UpdateResult result = bus.update(2);
+    EXPECT_EQ(result.processed_frames, 2);
+    EXPECT_TRUE(result.more_pending);
+    EXPECT_EQ(device.received_frames.size(), 2);
+
+    result = bus.update(2);
+    EXPECT_EQ(result.processed_frames, 2);
+    EXPECT_TRUE(result.more_pending);
+
+    result = bus.update(2);
+    EXPECT_EQ(result.processed_frames, 1);
+    EXPECT_FALSE(result.more_pending);
+    EXPECT_EQ(device.received_frames.size(), 5);
+}
+
+TEST_F(CANBusTest, UpdateWithExactBudgetReportsNothingPending)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    driver.push_receive_frame(frame);
+    driver.push_receive_frame(frame);
+
+    UpdateResult result = bus.update(2);
+    EXPECT_EQ(result.processed_frames, 2);
+    EXPECT_FALSE(result.more_pending);
+}
+
+namespace {
+
+/**
+ * @brief now() が呼ばれるたびに1msずつ進むテスト用クロック
+ *
+ */
+struct SteppingClock {
+    using duration                  = std::chrono::milliseconds;
+    using rep                       = duration::rep;
+    using period                    = duration::period;
+    using time_point                = std::chrono::time_point<SteppingClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now()
+    {
+        return time_point(duration(ticks++));
+    }
+
+    static rep ticks;
+};
+
+SteppingClock::rep SteppingClock::ticks = 0;
+
+}  // namespace
+
+TEST_F(CANBusTest, UpdateUntilDeadline)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    for (int i = 0; i < 10; ++i) {
+        driver.push_receive_frame(frame);
+    }
+
+    // 1フレームごとに1ms進むので、3ms後の期限までに3フレーム処理される
+    SteppingClock::ticks = 0;
+    auto deadline        = SteppingClock::time_point(std::chrono::milliseconds(3));
+    UpdateResult result  = bus.update_until(deadline);
+    EXPECT_EQ(result.processed_frames, 3);
+    EXPECT_TRUE(result.more_pending);
+
+    // 期限に余裕があれば全て処理して戻る
+    result = bus.update_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
+    EXPECT_EQ(result.processed_frames, 7);
+    EXPECT_FALSE(result.more_pending);
+    EXPECT_EQ(device.received_frames.size(), 10);
+}
+
+TEST_F(CANBusTest, UpdateReceivesInBatches)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    for (int i = 0; i < 20; ++i) {
+        driver.push_receive_frame(frame);
+    }
+
+    // 8 + 8 + 4 フレームを読み出し、最後の呼び出しで空を確認する
+    bus.update();
+    EXPECT_EQ(device.received_frames.size(), 20);
+    EXPECT_EQ(driver.receive_batch_calls, 4);
+}
+
+namespace {
+
+/**
+ * @brief 受信フレームがドライバーの受信キュー上のものか確認するデバイス
+ *
+ */
+class ZeroCopyDevice : public CANDevice
+{
+public:
+    ZeroCopyDevice(ICANBus& bus, MockDriver& driver)
+        : CANDevice(bus, id::DeviceType::MotorDriver, 1), driver_(driver)
+    {
+    }
+
+    void on_receive(const CANFrame& frame) override
+    {
+        if (&frame == &driver_.receive_queue.front()) {
+            in_place++;
+        }
+        received++;
+    }
+
+    std::size_t in_place = 0;
+    std::size_t received = 0;
+
+private:
+    MockDriver& driver_;
+};
+
+}  // namespace
+
+TEST_F(CANBusTest, ZeroCopyReceiveDeliversDriverBuffer)
+{
+    driver.zero_copy = true;
+    ZeroCopyDevice device(bus, driver);
+
+    CANFrame frame;
+    frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    for (int i = 0; i < 5; ++i) {
+        driver.push_receive_frame(frame);
+    }
+
+    // 予算で止まった場合も、残りのフレームは取り出さずに確認する
+    UpdateResult result = bus.update(3);
+    EXPECT_EQ(result.processed_frames, 3);
+    EXPECT_TRUE(result.more_pending);
+    EXPECT_EQ(driver.receive_queue.size(), 2);
+
+    bus.update();
+    EXPECT_EQ(device.received, 5);
+    EXPECT_EQ(device.in_place, 5);
+    EXPECT_EQ(driver.release_calls, 5);
+    EXPECT_EQ(driver.receive_batch_calls, 1);  // 空になった後の確認のみ
+    EXPECT_TRUE(driver.receive_queue.empty());
+}
+
+namespace {
+
+/**
+ * @brief send() / receive() だけを実装したドライバー（バッチ関数は既定の実装を使う）
+ *
+ */
+class SingleFrameDriver : public drivers::ICANDriver
+{
+public:
+    bool send(const CANFrame&) override
+    {
+        if (send_budget == 0) {
+            return false;
+        }
+        send_budget--;
+        return true;
+    }
+
+    bool receive(CANFrame& out_frame) override
+    {
+        if (receive_remaining == 0) {
+            return false;
+        }
+        out_frame.id = --receive_remaining;
+        return true;
+    }
+
+    std::size_t send_budget       = 0;
+    std::size_t receive_remaining = 0;
+};
+
+}  // namespace
+
+TEST(DriverBatchTest, DefaultBatchFallsBackToSingleFrameCalls)
+{
+    SingleFrameDriver driver;
+    std::array<CANFrame, 4> frames{};
+
+    driver.send_budget = 3;
+    EXPECT_EQ(driver.send_batch(frames.data(), frames.size()), 3);  // 失敗した時点で止まる
+
+    driver.receive_remaining = 6;
+    EXPECT_EQ(driver.receive_batch(frames.data(), frames.size()), 4);
+    EXPECT_EQ(frames[0].id, 5);
+    EXPECT_EQ(frames[3].id, 2);
+    EXPECT_EQ(driver.receive_batch(frames.data(), frames.size()), 2);
+    EXPECT_EQ(driver.receive_batch(frames.data(), frames.size()), 0);
+}
+
+namespace {
+
+/**
+ * @brief コマンドテーブルで受信するデバイス
+ *
+ */
+class TableDevice : public CANDevice
+{
+public:
+    TableDevice(ICANBus& bus, uint8_t id) : CANDevice(bus, id::DeviceType::MotorDriver, id)
+    {
+        set_command_table(COMMAND_TABLE);
+    }
+
+    int target_count   = 0;
+    int feedback_count = 0;
+
+private:
+    static const CommandTable COMMAND_TABLE;
+
+    void handle_target(const CANFrame&)
+    {
+        target_count++;
+    }
+
+    void handle_feedback(const CANFrame&)
+    {
+        feedback_count++;
+    }
+};
+
+const TableDevice::CommandTable TableDevice::COMMAND_TABLE = [] {
+    CommandTable table{};
+    table[command_index(id::MsgTypeMotorDriver::Target)] =
+        command_handler<TableDevice, &TableDevice::handle_target>;
+    table[command_index(id::MsgTypeMotorDriver::Feedback)] =
+        command_handler<TableDevice, &TableDevice::handle_feedback>;
+    return table;
+}();
+
+}  // namespace
+
+TEST_F(CANBusTest, CommandTableDispatchesToHandler)
+{
+    TableDevice device(bus, 1);
+    MockDevice plain(bus, id::DeviceType::MotorDriver, 1);
+
+    auto make = [](id::MsgTypeMotorDriver command) {
+        return CANFrame::make(id::DeviceType::MotorDriver, 1, command);
+    };
+    CANFrame target   = make(id::MsgTypeMotorDriver::Target);
+    CANFrame feedback = make(id::MsgTypeMotorDriver::Feedback);
+    CANFrame gain     = make(id::MsgTypeMotorDriver::Gain);
+    driver.push_receive_frame(target);
+    driver.push_receive_frame(target);
+    driver.push_receive_frame(feedback);
+    driver.push_receive_frame(gain);
+    bus.update();
+
+    EXPECT_EQ(device.target_count, 2);
+    EXPECT_EQ(device.feedback_count, 1);
+    EXPECT_EQ(plain.received_frames.size(), 4);  // テーブルを持たないデバイスは on_receive() で受ける
+
+    // on_receive() を直接呼んでもテーブルを引く（未登録のコマンドは無視する）
+    device.on_receive(feedback);
+    device.on_receive(gain);
+    EXPECT_EQ(device.feedback_count, 2);
+    EXPECT_EQ(device.target_count, 2);
+}
+
+TEST(BasicBusTest, LargeCapacityDetachKeepsRouting)
+{
+    // 全ルーティングIDを保持するマスター向けの容量
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 256> bus{driver};
+    std::vector<std::unique_ptr<MockDevice>> devices;
+    for (std::size_t i = 0; i < 256; ++i) {
+        devices.push_back(std::make_unique<MockDevice>(
+            bus, static_cast<id::DeviceType>(i >> id::BIT_WIDTH_DEV_ID), i & 0x0F
+        ));
+        ASSERT_TRUE(devices.back()->is_attached());
+    }
+    MockDevice duplicate(bus, id::DeviceType::MotorDriver, 1);
+    EXPECT_FALSE(duplicate.is_attached());
+
+    // 先頭・中間・末尾を順不同に解除する
+    for (std::size_t i : {std::size_t{0}, std::size_t{255}, std::size_t{128}, std::size_t{17}}) {
+        devices[i].reset();
+    }
+    EXPECT_EQ(bus.device_count(), 252);
+
+    for (std::size_t i = 0; i < 256; ++i) {
+        CANFrame frame;
+        frame.id = static_cast<uint32_t>(i) << id::BIT_WIDTH_COMMAND;
+        driver.push_receive_frame(frame);
+    }
+    bus.update();
+    for (std::size_t i = 0; i < 256; ++i) {
+        if (devices[i] != nullptr) {
+            EXPECT_EQ(devices[i]->received_frames.size(), 1) << i;
+        }
+    }
+}
+
+TEST(BasicBusTest, SmallCapacityReusesRoutingEntries)
+{
+    // 容量が小さいバスは256エントリの表を持たない
+    using SmallBus = BasicBus<CANFrame, drivers::ICANDriver, 2, 0, 1>;
+    using LargeBus = BasicBus<CANFrame, drivers::ICANDriver, 256, 0, 1>;
+    static_assert(sizeof(SmallBus) + 1024 < sizeof(LargeBus), "small bus must not hold 256 heads");
+
+    MockDriver driver;
+    SmallBus bus{driver};
+    auto motor = std::make_unique<MockDevice>(bus, id::DeviceType::MotorDriver, 1);
+    MockDevice servo(bus, id::DeviceType::ServoMotor, 2);
+    motor.reset();
+
+    // 解除したルーティングIDの枠を別のIDで使い直す
+    MockDevice solenoid(bus, id::DeviceType::SolenoidDriver, 3);
+    ASSERT_TRUE(solenoid.is_attached());
+
+    for (const MockDevice* device : {&servo, &solenoid}) {
+        CANFrame frame;
+        frame.id = device->get_routing_id() << id::BIT_WIDTH_COMMAND;
+        driver.push_receive_frame(frame);
+    }
+    CANFrame unrouted;
+    unrouted.id = id::pack(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Init);
+    driver.push_receive_frame(unrouted);
+    bus.update();
+
+    EXPECT_EQ(servo.received_frames.size(), 1);
+    EXPECT_EQ(solenoid.received_frames.size(), 1);
+    EXPECT_EQ(bus.stats().unrouted_frames, 1);
+}
+
+TEST_F(CANBusTest, DetachRemapsRoutingIndex)
+{
+    // 既定の容量 (16) のバスは索引でルーティングIDを引く。解除で索引を詰めても配送先が変わらない
+    auto motor = std::make_unique<MockDevice>(bus, id::DeviceType::MotorDriver, 1);
+    MockDevice servo(bus, id::DeviceType::ServoMotor, 2);
+    MockDevice solenoid(bus, id::DeviceType::SolenoidDriver, 3);
+    motor.reset();
+    MockDevice sensor(bus, id::DeviceType::SensorHub, 4);
+
+    for (const MockDevice* device : {&servo, &solenoid, &sensor}) {
+        CANFrame frame;
+        frame.id = device->get_routing_id() << id::BIT_WIDTH_COMMAND;
+        driver.push_receive_frame(frame);
+    }
+    CANFrame unrouted;
+    unrouted.id = id::pack(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Init);
+    driver.push_receive_frame(unrouted);
+    bus.update();
+
+    EXPECT_EQ(servo.received_frames.size(), 1);
+    EXPECT_EQ(solenoid.received_frames.size(), 1);
+    EXPECT_EQ(sensor.received_frames.size(), 1);
+    EXPECT_EQ(bus.stats().unrouted_frames, 1);
+}
+
+TEST_F(CANBusTest, DetachFromMiddleAndTailOfSameRoutingId)
+{
+    MockDevice first(bus, id::DeviceType::MotorDriver, 1);
+    auto second = std::make_unique<MockDevice>(bus, id::DeviceType::MotorDriver, 1);
+    auto third  = std::make_unique<MockDevice>(bus, id::DeviceType::MotorDriver, 1);
+
+    CANFrame frame;
+    frame.id = first.get_routing_id() << id::BIT_WIDTH_COMMAND;
+
+    third.reset();  // 末尾
+    MockDevice fourth(bus, id::DeviceType::MotorDriver, 1);
+    second.reset();  // 中間
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    EXPECT_EQ(first.received_frames.size(), 1);
+    EXPECT_EQ(fourth.received_frames.size(), 1);
+}
+
+TEST_F(CANBusTest, StatsCountRxUnroutedAndMaxFramesPerUpdate)
+{
+    MockDevice device(bus, id::DeviceType::MotorDriver, 1);
+    CANFrame routed;
+    routed.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+    CANFrame unrouted;
+    unrouted.id = 0x7FF;
+
+    driver.push_receive_frame(routed);
+    driver.push_receive_frame(unrouted);
+    driver.push_receive_frame(routed);
+    bus.update();
+    driver.push_receive_frame(routed);
+    bus.update();
+
+    BusStats stats = bus.stats();
+    EXPECT_EQ(stats.rx_frames, 4);
+    EXPECT_EQ(stats.unrouted_frames, 1);
+    EXPECT_EQ(stats.max_frames_per_update, 3);
+    EXPECT_EQ(device.stats().rx_frames, 3);
+}
+
+TEST(BasicBusTest, StatsCountTxFramesAndFailures)
+{
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 16, 0> bus(driver);  // 送信キューなし
+    CANFrame frame;
+    frame.id = 0x100;
+
+    EXPECT_TRUE(bus.send_frame(frame));
+    driver.accept_send = false;
+    EXPECT_FALSE(bus.send_frame(frame));
+
+    BusStats stats = bus.stats();
+    EXPECT_EQ(stats.tx_frames, 1);
+    EXPECT_EQ(stats.tx_failures, 1);
+
+    // 割り込み用の取得も同じ値を返す
+    BusStats from_isr;
+    ASSERT_TRUE(bus.try_stats(from_isr));
+    EXPECT_EQ(from_isr.tx_frames, 1);
+    EXPECT_EQ(from_isr.tx_failures, 1);
+}
+
+TEST_F(CANBusTest, DeviceCachesRoutingIdAndCanIds)
+{
+    MockDevice device(bus, id::DeviceType::ServoMotor, 5);
+
+    uint32_t target = id::pack(id::DeviceType::ServoMotor, 5, id::MsgTypeServoMotor::AngleRad);
+    EXPECT_EQ(device.can_id(id::MsgTypeServoMotor::AngleRad), target);
+    EXPECT_EQ(
+        device.can_id(id::MsgTypeServoMotor::Init), id::base_id(id::DeviceType::ServoMotor, 5)
+    );
+    EXPECT_EQ(device.get_routing_id(), target >> id::BIT_WIDTH_COMMAND);
+
+    // 受信フレームのルーティングIDと一致し、配送される
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::ServoMotor, 5, id::MsgTypeServoMotor::AngleRad)
+    );
+    bus.update();
+    EXPECT_EQ(device.received_frames.size(), 1);
+}
@@ -2,6 +2,7 @@
 
 #include "gn10_can/core/can_frame.hpp"
 #include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/fdcan_frame.hpp"
 
 using namespace gn10_can;
 
@@ -51,3 +52,100 @@ TEST(CANFrameTest, SetData)
     EXPECT_EQ(frame.dlc, 8);
     EXPECT_EQ(frame.data[7], 0x80);
 }
+
+TEST(CANFrameTest, TimestampAccessors)
+{
+    CANFrame frame;
+    EXPECT_EQ(frame.timestamp(), 0);
+    frame.set_timestamp(1234);
+    if constexpr (CANFrame::HAS_TIMESTAMP) {
+        EXPECT_EQ(frame.timestamp(), 1234);
+    } else {
+        EXPECT_EQ(frame.timestamp(), 0);  // 無効時はフィールドを持たず、設定は無視される
+    }
+
+    CANFrame other = frame;
+    other.set_timestamp(5678);
+    EXPECT_EQ(frame, other);  // 受信時刻は比較しない
+}
+
+TEST(CANFrameTest, DlcCodeRoundTrip)
+{
+    const std::size_t lengths[] = {0, 1, 8, 12, 16, 20, 24, 32, 48, 64};
+    for (std::size_t length : lengths) {
+        uint8_t code = FDCANFrame::to_dlc_code(length);
+        EXPECT_LE(code, 15);
+        EXPECT_EQ(FDCANFrame::from_dlc_code(code), length);
+    }
+    EXPECT_EQ(FDCANFrame::to_dlc_code(12), 9);
+    EXPECT_EQ(FDCANFrame::to_dlc_code(64), 15);
+}
+
+TEST(CANFrameTest, DlcCodeRoundsUpUnencodableLengths)
+{
+    EXPECT_EQ(FDCANFrame::to_dlc_code(9), 9);
+    EXPECT_EQ(FDCANFrame::to_dlc_code(25), 13);
+    EXPECT_EQ(FDCANFrame::to_dlc_code(100), 15);  // MAX_DLC に切り詰める
+
+    // クラシックCANの 9〜15 は8byte
+    EXPECT_EQ(CANFrame::to_dlc_code(20), 8);
+    EXPECT_EQ(CANFrame::from_dlc_code(15), 8);
+}
+
+TEST(CANFrameTest, FdSetDataPadsToEncodableLength)
+{
+    FDCANFrame frame;
+    frame.data.fill(0xFF);
+    std::array<uint8_t, 10> bytes{};
+    bytes.fill(0x11);
+    frame.set_data(bytes.data(), bytes.size());
+
+    EXPECT_EQ(frame.dlc, 12);
+    EXPECT_EQ(frame.data[9], 0x11);
+    EXPECT_EQ(frame.data[10], 0);
+    EXPECT_EQ(frame.data[11], 0);
+    EXPECT_TRUE(frame.is_fd);
+    EXPECT_FALSE(frame.bit_rate_switch);
+    EXPECT_FALSE(CANFrame{}.is_fd);
+}
+
+namespace {
+
+// 定数の引数からコンパイル時に作成できる（static_assert で確認する）
+constexpr uint32_t SERVO_ANGLE_ID =
+    id::pack(id::DeviceType::ServoMotor, 3, id::MsgTypeServoMotor::AngleRad);
+static_assert(SERVO_ANGLE_ID == ((2u << 7) | (3u << 3) | 1u), "id::pack() must be constexpr");
+static_assert(id::base_id(id::DeviceType::ServoMotor, 3) == (SERVO_ANGLE_ID & ~0x7u));
+static_assert(id::unpack(SERVO_ANGLE_ID).type == id::DeviceType::ServoMotor);
+static_assert(id::unpack(SERVO_ANGLE_ID).dev_id == 3);
+static_assert(id::unpack(SERVO_ANGLE_ID).is_command(id::MsgTypeServoMotor::AngleRad));
+
+constexpr CANFrame SOLENOID_ON = CANFrame::make(
+    id::DeviceType::SolenoidDriver, 1, id::MsgTypeSolenoidDriver::Target, {0x01, 0x02}
+);
+static_assert(SOLENOID_ON.dlc == 2, "CANFrame::make() must be constexpr");
+static_assert(SOLENOID_ON.data[1] == 0x02);
+static_assert(SOLENOID_ON.get_routing_id() == ((3u << id::BIT_WIDTH_DEV_ID) | 1u));
+static_assert(SOLENOID_ON == SOLENOID_ON);
+
+constexpr FDCANFrame make_padded_fd_frame()
+{
+    FDCANFrame frame;
+    frame.data[10]      = 0xFF;
+    uint8_t payload[10] = {};
+    frame.set_data(payload, sizeof(payload));
+    return frame;
+}
+static_assert(make_padded_fd_frame().dlc == 12, "FDCANFrame::set_data() must be constexpr");
+static_assert(make_padded_fd_frame().data[10] == 0);
+
+}  // namespace
+
+TEST(CANFrameTest, ConstexprFrameMatchesRuntimeFrame)
+{
+    uint8_t payload[] = {0x01, 0x02};
+    CANFrame runtime  = CANFrame::make(
+        id::DeviceType::SolenoidDriver, 1, id::MsgTypeSolenoidDriver::Target, payload, 2
+    );
+    EXPECT_EQ(runtime, SOLENOID_ON);
+}
@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/devices/esc_hub_client.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/utils/can_converter.hpp"
+#include "gn10_can/utils/mpsc_ring_buffer.hpp"
+#include "gn10_can/utils/seqlock.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+TEST(MPSCRingBufferTest, FifoAndFull)
+{
+    utils::MPSCRingBuffer<int, 4> ring;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    EXPECT_FALSE(ring.try_push(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.try_pop(value));
+
+    // 一周した後も使える
+    EXPECT_TRUE(ring.try_push(10));
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 10);
+}
+
+TEST(MPSCRingBufferTest, ReservedCellBlocksLaterCellsUntilPublished)
+{
+    utils::MPSCRingBuffer<int, 4> ring;
+    std::size_t position = 0;
+    int* slot            = ring.try_reserve(position);
+    ASSERT_NE(slot, nullptr);
+    EXPECT_TRUE(ring.try_push(2));
+
+    // 先に確保したセルが書き込み途中の間は、後のセルも取り出さない
+    int value = -1;
+    EXPECT_FALSE(ring.try_pop(value));
+
+    *slot = 1;
+    ring.publish(position);
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 1);
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 2);
+}
+
+TEST(SeqLockTest, StoresAndLoadsOddSizedValue)
+{
+    struct Sample {
+        float value;
+        uint8_t flags;
+    };
+    utils::SeqLock<Sample> lock;
+    EXPECT_EQ(lock.load().flags, 0);
+    lock.store(Sample{1.5f, 3});
+    EXPECT_FLOAT_EQ(lock.load().value, 1.5f);
+    EXPECT_EQ(lock.load().flags, 3);
+}
+
+TEST(SeqLockTest, TryLoadReturnsStableValue)
+{
+    utils::SeqLock<uint64_t> lock(42);
+    uint64_t value = 0;
+    EXPECT_TRUE(lock.try_load(value));
+    EXPECT_EQ(value, 42u);
+    lock.store(7);
+    EXPECT_TRUE(lock.try_load(value, 1));
+    EXPECT_EQ(value, 7u);
+    EXPECT_FALSE(lock.try_load(value, 0));  // 試行0回は常に失敗し、値を変えない
+    EXPECT_EQ(value, 7u);
+}
+
+TEST(ConcurrentBusTest, SendIsDeferredToUpdateThread)
+{
+    MockDriver driver;
+    ConcurrentCANBus bus(driver);
+    devices::MotorDriverClient client(bus, 1);
+
+    EXPECT_TRUE(client.set_gain(devices::GainType::Kp, 1.0f));
+    EXPECT_TRUE(driver.sent_frames.empty());
+    bus.flush();
+    EXPECT_EQ(driver.sent_frames.size(), 1);
+}
+
+TEST(ConcurrentBusTest, RingOverflowIsReported)
+{
+    MockDriver driver;
+    BasicConcurrentBus<CANFrame, drivers::ICANDriver, 16, 2> bus(driver);
+    CANFrame frame;
+    EXPECT_TRUE(bus.send_frame(frame));
+    EXPECT_TRUE(bus.send_frame(frame));
+    EXPECT_FALSE(bus.send_frame(frame));
+    EXPECT_EQ(bus.ring_dropped_frames(), 1);
+    bus.update();
+    EXPECT_EQ(driver.sent_frames.size(), 2);
+}
+
+TEST(ConcurrentBusTest, ManyProducersOneRxThreadAndSnapshotReaders)
+{
+    constexpr int PRODUCERS          = 8;
+    constexpr int SENDS_PER_PRODUCER = 2000;
+    constexpr int READERS            = 2;
+
+    MockDriver driver;
+    ConcurrentCANBus bus(driver);
+    std::vector<std::unique_ptr<devices::MotorDriverClient>> clients;
+    for (int i = 0; i < PRODUCERS; ++i) {
+        clients.push_back(std::make_unique<devices::MotorDriverClient>(bus, i));
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> accepted{0};
+    std::atomic<int> rejected{0};
+    std::atomic<int> torn_reads{0};
+
+    // 受信スレッド: フィードバックを受信させ、送信リングバッファを処理する
+    std::thread rx_thread([&]() {
+        uint32_t count = 0;
+        while (!stop.load(std::memory_order_acquire)) {
+            // 値とリミットスイッチ状態を対応させたフィードバック
+            std::array<uint8_t, 5> payload{};
+            converter::pack(payload, 0, static_cast<float>(count % 256));
+            converter::pack(payload, 4, static_cast<uint8_t>(count % 256));
+            driver.push_receive_frame(CANFrame::make(
+                id::DeviceType::MotorDriver,
+                0,
+                id::MsgTypeMotorDriver::Feedback,
+                payload.data(),
+                payload.size()
+            ));
+            bus.update();
+            count++;
+        }
+        bus.flush();
+    });
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_acquire)) {
+                devices::MotorFeedback feedback = clients[0]->feedback();
+                if (static_cast<uint8_t>(feedback.value) != feedback.limit_switches) {
+                    torn_reads.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < SENDS_PER_PRODUCER; ++i) {
+                bool ok = false;
+                if (i % 2 == 0) {
+                    ok = clients[p]->set_target(static_cast<float>(i));
+                } else {
+                    ok = clients[p]->set_gain(devices::GainType::Kp, 1.0f);
+                }
+                if (ok) {
+                    accepted.fetch_add(1);
+                } else {
+                    rejected.fetch_add(1);
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    stop.store(true, std::memory_order_release);
+    rx_thread.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(accepted.load() + rejected.load(), PRODUCERS * SENDS_PER_PRODUCER);
+    EXPECT_EQ(static_cast<int>(driver.sent_frames.size()), accepted.load());
+    EXPECT_EQ(static_cast<int>(bus.ring_dropped_frames()), rejected.load());
+    EXPECT_EQ(torn_reads.load(), 0);
+}
+
+namespace {
+
+FDCANFrame esc_hub_feedback_frame(uint8_t dev_id, float value)
+{
+    FDCANFrame frame = FDCANFrame::make(
+        id::DeviceType::ESCHub, dev_id, id::MsgTypeESCHub::AngularVelocitiesFeedbacks
+    );
+    for (int i = 0; i < 4; ++i) {
+        converter::pack(frame.data, i * sizeof(float), value + static_cast<float>(i));
+    }
+    frame.dlc = sizeof(float) * 4;
+    return frame;
+}
+
+}  // namespace
+
+TEST(ESCHubClientTest, FeedbackIsReturnedOncePerFrame)
+{
+    MockFDDriver driver;
+    FDCANBus bus(driver);
+    devices::ESCHubClient client(bus, 1);
+
+    float feedbacks[4] = {};
+    EXPECT_FALSE(client.get_angular_velocity_feedbacks(feedbacks));
+
+    driver.push_receive_frame(esc_hub_feedback_frame(1, 10.0f));
+    bus.update();
+    ASSERT_TRUE(client.get_angular_velocity_feedbacks(feedbacks));
+    EXPECT_FLOAT_EQ(feedbacks[0], 10.0f);
+    EXPECT_FLOAT_EQ(feedbacks[3], 13.0f);
+    EXPECT_FALSE(client.get_angular_velocity_feedbacks(feedbacks));  // 新しい受信はまだない
+}
+
+TEST(ESCHubClientTest, SendsUseTheESCHubId)
+{
+    MockFDDriver driver;
+    FDCANBus bus(driver);
+    devices::ESCHubClient client(bus, 2);
+
+    EXPECT_TRUE(client.set_gain_all(devices::ESCHubConfig{}));
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(
+        driver.sent_frames[0].id, id::pack(id::DeviceType::ESCHub, 2, id::MsgTypeESCHub::Gain)
+    );
+    EXPECT_EQ(driver.sent_frames[0].dlc, sizeof(devices::ESCHubConfig));
+}
+
+TEST(ConcurrentBusTest, ESCHubFeedbackIsNeverTorn)
+{
+    constexpr int FRAMES = 20000;
+
+    MockFDDriver driver;
+    ConcurrentFDCANBus bus(driver);
+    devices::ESCHubClient client(bus, 0);
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn_reads{0};
+
+    std::thread rx_thread([&]() {
+        for (int i = 0; i < FRAMES; ++i) {
+            driver.push_receive_frame(esc_hub_feedback_frame(0, static_cast<float>(i % 1024)));
+            bus.update();
+        }
+        stop.store(true, std::memory_order_release);
+    });
+
+    // 4つの角速度は同じフレームの組 (value, value + 1, ...) で返る
+    float feedbacks[4] = {};
+    while (!stop.load(std::memory_order_acquire)) {
+        if (!client.get_angular_velocity_feedbacks(feedbacks)) {
+            continue;
+        }
+        for (int i = 1; i < 4; ++i) {
+            if (feedbacks[i] != feedbacks[0] + static_cast<float>(i)) {
+                torn_reads.fetch_add(1);
+            }
+        }
+    }
+    rx_thread.join();
+
+    EXPECT_EQ(torn_reads.load(), 0);
+}
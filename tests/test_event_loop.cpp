@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/event_loop.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+/**
+ * @brief 受信フレームがある間だけ読み込み可能になる eventfd を持つ MockDriver
+ *
+ * 送信側は eventfd が常に書き込み可能なため、accept_send で送信の可否を切り替える。
+ */
+class FdMockDriver : public MockDriver
+{
+public:
+    FdMockDriver() : fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+
+    ~FdMockDriver() override
+    {
+        close(fd_);
+    }
+
+    int event_fd() const override
+    {
+        return fd_;
+    }
+
+    bool receive(CANFrame& out_frame) override
+    {
+        bool received = MockDriver::receive(out_frame);
+        clear_if_empty();
+        return received;
+    }
+
+    std::size_t receive_batch(CANFrame* out_frames, std::size_t max_frames) override
+    {
+        std::size_t received = MockDriver::receive_batch(out_frames, max_frames);
+        clear_if_empty();
+        return received;
+    }
+
+    void signal_rx()
+    {
+        uint64_t one  = 1;
+        ssize_t bytes = write(fd_, &one, sizeof(one));
+        (void)bytes;
+    }
+
+private:
+    void clear_if_empty()
+    {
+        if (receive_queue.empty()) {
+            uint64_t count = 0;
+            ssize_t bytes  = read(fd_, &count, sizeof(count));
+            (void)bytes;
+        }
+    }
+
+    int fd_;
+};
+
+CANFrame feedback_frame()
+{
+    return CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback);
+}
+
+}  // namespace
+
+TEST(EventLoopTest, TimesOutWithoutReadiness)
+{
+    FdMockDriver driver;
+    CANBus bus(driver);
+    EventLoop<CANBus> loop(bus, driver.event_fd());
+    ASSERT_TRUE(loop.is_open());
+
+    EXPECT_EQ(loop.run_once(0), 0);
+}
+
+TEST(EventLoopTest, WakesWhenDriverHasFrames)
+{
+    FdMockDriver driver;
+    CANBus bus(driver);
+    devices::MotorDriverClient client(bus, 1);
+    EventLoop<CANBus> loop(bus, driver.event_fd());
+
+    driver.push_receive_frame(feedback_frame());
+    driver.signal_rx();
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(loop.run_once(5000), 1);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_TRUE(driver.receive_queue.empty());
+
+    // 受信し終えたら再び眠る
+    EXPECT_EQ(loop.run_once(0), 0);
+}
+
+TEST(EventLoopTest, NotifyWakesFromAnotherThread)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    EventLoop<CANBus> loop(bus, driver.event_fd());  // fd なし: notify() のみで起きる
+    ASSERT_TRUE(loop.is_open());
+
+    std::thread waker([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        driver.push_receive_frame(feedback_frame());
+        loop.notify();
+    });
+    EXPECT_EQ(loop.run_once(-1), 1);
+    waker.join();
+    EXPECT_TRUE(driver.receive_queue.empty());
+}
+
+TEST(EventLoopTest, WaitsForTxSlotWhileQueueIsPending)
+{
+    FdMockDriver driver;
+    CANBus bus(driver);
+    EventLoop<CANBus> loop(bus, driver.event_fd());
+
+    driver.accept_send = false;
+    ASSERT_TRUE(bus.send_frame(feedback_frame()));  // ソフトウェア送信キューに積まれる
+    ASSERT_EQ(bus.tx_queue_stats().depth, 1);
+
+    driver.accept_send = true;
+    EXPECT_EQ(loop.run_once(5000), 1);  // 送信可能で起きて flush する
+    EXPECT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(bus.tx_queue_stats().depth, 0);
+
+    // 送信待ちがなくなれば送信可能では起きない
+    EXPECT_EQ(loop.run_once(0), 0);
+}
+
+TEST(EventLoopTest, WakesWhenAnotherThreadSendsOnConcurrentBus)
+{
+    MockDriver driver;
+    ConcurrentCANBus bus(driver);
+    EventLoop<ConcurrentCANBus> loop(bus, driver.event_fd());  // fd なし: notify() を呼ばない
+    ASSERT_TRUE(loop.is_open());
+
+    std::thread sender([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        bus.send_frame(feedback_frame());  // リングバッファに積むだけで受信スレッドが起きる
+    });
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(loop.run_once(5000), 1);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    sender.join();
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+
+    // 読み出した後は、次の送信まで再び眠る
+    EXPECT_EQ(loop.run_once(0), 0);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/core/flight_recorder.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+CANFrame make_frame(uint32_t id, uint8_t first_byte)
+{
+    CANFrame frame;
+    frame.id = id;
+    frame.set_data(&first_byte, 1);
+    return frame;
+}
+
+bool is_emergency_stop(const CANFrame& frame, TapDirection)
+{
+    return id::unpack(frame.id).type == id::DeviceType::EmergencyStop;
+}
+
+template <typename Recorder>
+std::vector<FlightRecordEntry> read_all(const Recorder& recorder, bool* frozen = nullptr)
+{
+    std::vector<uint8_t> dump(recorder.dump_size());
+    EXPECT_EQ(recorder.dump(dump.data(), dump.size()), dump.size());
+
+    FlightRecordReader reader(dump.data(), dump.size());
+    EXPECT_TRUE(reader.valid());
+    if (frozen != nullptr) {
+        *frozen = reader.frozen();
+    }
+    std::vector<FlightRecordEntry> entries;
+    FlightRecordEntry entry;
+    while (reader.next(entry)) {
+        entries.push_back(entry);
+    }
+    EXPECT_TRUE(reader.valid());
+    EXPECT_EQ(entries.size(), reader.entry_count());
+    return entries;
+}
+
+class FlightRecorderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fake_now_us = 1000;
+        bus.set_time_source(fake_time_source);
+        bus.add_tap(recorder);
+    }
+
+    void receive(uint32_t id, uint8_t first_byte, TimestampUs now_us)
+    {
+        fake_now_us = now_us;
+        driver.push_receive_frame(make_frame(id, first_byte));
+        bus.update();
+    }
+
+    MockDriver driver;
+    CANBus bus{driver};
+    CANFlightRecorder<256> recorder;
+};
+
+}  // namespace
+
+TEST_F(FlightRecorderTest, RecordsRxAndTxWithTimestamps)
+{
+    receive(0x123, 0xAA, 1000);
+    fake_now_us = 1250;
+    CANFrame extended    = make_frame(0x1ABCDEF, 0xBB);
+    extended.is_extended = true;
+    EXPECT_TRUE(bus.send_frame(extended));
+    receive(0x124, 0xCC, 900);  // 時刻が戻っても記録できる
+
+    std::vector<FlightRecordEntry> entries = read_all(recorder);
+    ASSERT_EQ(entries.size(), 3);
+
+    EXPECT_EQ(entries[0].direction, TapDirection::Rx);
+    EXPECT_EQ(entries[0].id, 0x123);
+    EXPECT_EQ(entries[0].timestamp_us, 1000);
+    EXPECT_EQ(entries[0].length, 1);
+    EXPECT_EQ(entries[0].data[0], 0xAA);
+
+    EXPECT_EQ(entries[1].direction, TapDirection::Tx);
+    EXPECT_EQ(entries[1].id, 0x1ABCDEF);
+    EXPECT_TRUE(entries[1].is_extended);
+    EXPECT_EQ(entries[1].timestamp_us, 1250);
+
+    EXPECT_EQ(entries[2].timestamp_us, 900);
+}
+
+TEST_F(FlightRecorderTest, OverwritesOldestEntries)
+{
+    for (uint32_t i = 0; i < 100; ++i) {
+        receive(0x100 + i, static_cast<uint8_t>(i), 1000 + i * 10);
+    }
+    EXPECT_GT(recorder.overwritten_count(), 0);
+    EXPECT_EQ(recorder.entry_count() + recorder.overwritten_count(), 100);
+
+    std::vector<FlightRecordEntry> entries = read_all(recorder);
+    ASSERT_EQ(entries.size(), recorder.entry_count());
+
+    // 残っているのは直近の記録で、時刻は上書き後も正しい
+    const FlightRecordEntry& last = entries.back();
+    EXPECT_EQ(last.id, 0x100 + 99);
+    EXPECT_EQ(last.timestamp_us, 1000 + 99 * 10);
+    const FlightRecordEntry& oldest = entries.front();
+    uint32_t oldest_index           = oldest.id - 0x100;
+    EXPECT_EQ(oldest.timestamp_us, 1000 + oldest_index * 10);
+    EXPECT_EQ(oldest.data[0], oldest_index);
+}
+
+TEST_F(FlightRecorderTest, FreezesAfterTriggerAndPostTriggerFrames)
+{
+    recorder.set_trigger(is_emergency_stop, 2);
+    uint32_t stop_id =
+        id::pack(id::DeviceType::EmergencyStop, 0, id::MsgTypeEmergencyStop::EmergencyStop);
+
+    receive(0x100, 0, 1000);
+    receive(stop_id, 1, 1100);
+    EXPECT_FALSE(recorder.is_frozen());
+    receive(0x101, 0, 1200);
+    receive(0x102, 0, 1300);
+    EXPECT_TRUE(recorder.is_frozen());
+    receive(0x103, 0, 1400);  // 停止後は記録しない
+
+    bool frozen                            = false;
+    std::vector<FlightRecordEntry> entries = read_all(recorder, &frozen);
+    EXPECT_TRUE(frozen);
+    ASSERT_EQ(entries.size(), 4);
+    EXPECT_EQ(entries[1].id, stop_id);
+    EXPECT_EQ(entries.back().id, 0x102);
+
+    recorder.clear();
+    EXPECT_FALSE(recorder.is_frozen());
+    EXPECT_EQ(recorder.entry_count(), 0);
+}
+
+TEST(FlightRecorderFDTest, RecordsLongFDFrames)
+{
+    MockFDDriver driver;
+    FDCANBus bus(driver);
+    FDCANFlightRecorder<> recorder;
+    bus.add_tap(recorder);
+
+    FDCANFrame frame;
+    frame.id = 0x321;
+    std::vector<uint8_t> payload(48);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i);
+    }
+    frame.set_data(payload.data(), payload.size());
+    driver.push_receive_frame(frame);
+    bus.update();
+
+    std::vector<uint8_t> dump(recorder.dump_size());
+    ASSERT_EQ(recorder.dump(dump.data(), dump.size()), dump.size());
+    FlightRecordReader reader(dump.data(), dump.size());
+    EXPECT_TRUE(reader.is_fd());
+
+    FlightRecordEntry entry;
+    ASSERT_TRUE(reader.next(entry));
+    EXPECT_EQ(entry.id, 0x321);
+    EXPECT_EQ(entry.length, 48);
+    EXPECT_EQ(entry.data[47], 47);
+    EXPECT_FALSE(reader.next(entry));
+}
+
+TEST(FlightRecordReaderTest, RejectsInvalidDumps)
+{
+    CANFlightRecorder<256> recorder;
+    std::vector<uint8_t> dump(recorder.dump_size());
+    EXPECT_EQ(recorder.dump(dump.data(), dump.size() - 1), 0);  // 書き出し先が小さい
+
+    ASSERT_EQ(recorder.dump(dump.data(), dump.size()), dump.size());
+    EXPECT_TRUE(FlightRecordReader(dump.data(), dump.size()).valid());
+
+    dump[0] = 'X';
+    EXPECT_FALSE(FlightRecordReader(dump.data(), dump.size()).valid());
+    EXPECT_FALSE(FlightRecordReader(nullptr, 0).valid());
+}
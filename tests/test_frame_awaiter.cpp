@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/frame_awaiter.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+struct WaitResult {
+    bool finished = false;
+    std::optional<CANFrame> frame;
+};
+
+Task wait_feedback(CANFrameAwaiter<>& awaiter, TimestampUs timeout_us, WaitResult& result)
+{
+    result.frame = co_await awaiter.next_frame(
+        id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback, timeout_us
+    );
+    result.finished = true;
+}
+
+class FrameAwaiterTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fake_now_us = 1000;
+        bus.add_tap(awaiter);
+    }
+
+    // サーバー側のバスから送信したフレームをクライアント側のバスで受信させる
+    void deliver_server_frames()
+    {
+        for (const CANFrame& frame : server_driver.sent_frames) {
+            driver.push_receive_frame(frame);
+        }
+        server_driver.sent_frames.clear();
+        bus.update();
+        awaiter.poll();
+    }
+
+    MockDriver driver;
+    CANBus bus{driver};
+    devices::MotorDriverClient client{bus, 1};
+    CANFrameAwaiter<> awaiter{fake_time_source};
+
+    MockDriver server_driver;
+    CANBus server_bus{server_driver};
+    devices::MotorDriverServer server{server_bus, 1};
+};
+
+}  // namespace
+
+TEST_F(FrameAwaiterTest, ResumesAfterDeviceHasProcessedFrame)
+{
+    WaitResult result;
+    Task task = wait_feedback(awaiter, 10000, result);
+    EXPECT_FALSE(task.done());
+    EXPECT_EQ(awaiter.pending(), 1);
+
+    server.send_feedback(3.5f, 0x02);
+    deliver_server_frames();
+
+    ASSERT_TRUE(result.finished);
+    ASSERT_TRUE(result.frame.has_value());
+    EXPECT_EQ(
+        result.frame->id,
+        id::pack(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback)
+    );
+    EXPECT_FLOAT_EQ(client.feedback_value(), 3.5f);  // 再開時点でデバイスの状態も更新済み
+    EXPECT_TRUE(task.done());
+    EXPECT_EQ(awaiter.pending(), 0);
+}
+
+TEST_F(FrameAwaiterTest, IgnoresOtherIdsAndTxFrames)
+{
+    WaitResult result;
+    Task task = wait_feedback(awaiter, 10000, result);
+
+    server.send_hardware_status(1.0f, 30);
+    deliver_server_frames();
+    EXPECT_FALSE(result.finished);
+
+    // 同じIDでも自分が送信したフレームでは再開しない
+    bus.send_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Feedback)
+    );
+    awaiter.poll();
+    EXPECT_FALSE(result.finished);
+    EXPECT_FALSE(task.done());
+}
+
+TEST_F(FrameAwaiterTest, TimesOutWithNullopt)
+{
+    WaitResult result;
+    Task task = wait_feedback(awaiter, 500, result);
+
+    fake_now_us += 499;
+    awaiter.poll();
+    EXPECT_FALSE(result.finished);
+
+    fake_now_us += 1;
+    EXPECT_EQ(awaiter.poll(), 1);
+    EXPECT_TRUE(result.finished);
+    EXPECT_FALSE(result.frame.has_value());
+    EXPECT_EQ(awaiter.pending(), 0);
+}
+
+TEST_F(FrameAwaiterTest, FullPoolReturnsImmediately)
+{
+    CANFrameAwaiter<1> small_awaiter{fake_time_source};
+    bus.add_tap(small_awaiter);
+
+    auto wait = [&](WaitResult& result) -> Task {
+        result.frame    = co_await small_awaiter.next_frame(0x123, 1000);
+        result.finished = true;
+    };
+
+    WaitResult first;
+    WaitResult second;
+    Task first_task  = wait(first);
+    Task second_task = wait(second);
+
+    EXPECT_FALSE(first.finished);
+    EXPECT_TRUE(second.finished);  // 待機枠がないため中断せずに完了
+    EXPECT_FALSE(second.frame.has_value());
+}
+
+TEST_F(FrameAwaiterTest, DestroyingTaskReleasesWaiter)
+{
+    WaitResult result;
+    {
+        Task task = wait_feedback(awaiter, 10000, result);
+        EXPECT_EQ(awaiter.pending(), 1);
+    }
+    EXPECT_EQ(awaiter.pending(), 0);
+
+    server.send_feedback(1.0f, 0);
+    deliver_server_frames();
+    EXPECT_FALSE(result.finished);
+}
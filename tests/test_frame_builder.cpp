@@ -0,0 +1,293 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "gn10_can/core/frame_builder.hpp"
+#include "gn10_can/devices/esc_hub_client.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+class BuilderDevice : public CANDevice
+{
+public:
+    BuilderDevice(ICANBus& bus, uint8_t id) : CANDevice(bus, id::DeviceType::MotorDriver, id) {}
+
+    bool send_target(float value)
+    {
+        auto tx = begin_frame(id::MsgTypeMotorDriver::Target);
+        tx.write(value);
+        return send_frame(tx, TxMode::Coalesce);
+    }
+
+    bool send_oversized()
+    {
+        auto tx = begin_frame(id::MsgTypeMotorDriver::Target);
+        tx.write(uint64_t{0});
+        tx.write(uint8_t{0});
+        return send_frame(tx);
+    }
+
+    bool send_gain(uint8_t value)
+    {
+        return send(id::MsgTypeMotorDriver::Gain, &value, 1);
+    }
+};
+
+/**
+ * @brief 送信フレームを見たら、ビルダーで応答フレームを送るタップ
+ *
+ */
+class ReplyingTap : public CANTap
+{
+public:
+    explicit ReplyingTap(ICANBus& bus) : bus_(bus) {}
+
+    void on_frame(const CANFrame& frame, TapDirection direction, TimestampUs) override
+    {
+        if (direction != TapDirection::Tx || frame.id != 0x60) {
+            return;
+        }
+        CANFrameBuilder tx(bus_, 0x61);
+        tx.write(uint8_t{1});
+        reply_sent = tx.commit();
+    }
+
+    bool reply_sent = false;
+
+private:
+    ICANBus& bus_;
+};
+
+}  // namespace
+
+TEST(FrameBuilderTest, PaddedLengthFollowsDlcTable)
+{
+    EXPECT_EQ(CANFrame::padded_length(5), 5);
+    EXPECT_EQ(CANFrame::padded_length(8), 8);
+    EXPECT_EQ(FDCANFrame::padded_length(8), 8);
+    EXPECT_EQ(FDCANFrame::padded_length(9), 12);
+    EXPECT_EQ(FDCANFrame::padded_length(20), 20);
+    EXPECT_EQ(FDCANFrame::padded_length(25), 32);
+    EXPECT_EQ(FDCANFrame::padded_length(33), 48);
+    EXPECT_EQ(FDCANFrame::padded_length(49), 64);
+}
+
+TEST(FrameBuilderTest, WritesFieldsInPlace)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+
+    CANFrameBuilder tx(bus, 0x123);
+    EXPECT_TRUE(tx.write(uint16_t{0x0201}));
+    EXPECT_TRUE(tx.write(1.5f));
+    EXPECT_EQ(tx.size(), 6);
+    EXPECT_TRUE(tx.commit());
+    EXPECT_FALSE(tx.commit());  // 2回目は送信しない
+
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    const CANFrame& sent = driver.sent_frames[0];
+    EXPECT_EQ(sent.id, 0x123);
+    EXPECT_EQ(sent.dlc, 6);
+    EXPECT_EQ(sent.data[0], 0x01);
+    EXPECT_EQ(sent.data[1], 0x02);
+    float value = 0.0f;
+    std::memcpy(&value, &sent.data[2], sizeof(value));
+    EXPECT_FLOAT_EQ(value, 1.5f);
+}
+
+TEST(FrameBuilderTest, OverflowFailsWithoutSending)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    {
+        CANFrameBuilder tx(bus, 0x10);
+        EXPECT_TRUE(tx.write(uint32_t{1}));
+        EXPECT_FALSE(tx.write(uint64_t{2}));
+        EXPECT_FALSE(tx.ok());
+        EXPECT_FALSE(tx.commit());
+    }
+    EXPECT_TRUE(driver.sent_frames.empty());
+
+    // 失敗後も送信領域は返却されている
+    CANFrameBuilder tx(bus, 0x11);
+    EXPECT_TRUE(tx.ok());
+    EXPECT_TRUE(tx.commit());
+    EXPECT_EQ(driver.sent_frames.size(), 1);
+}
+
+TEST(FrameBuilderTest, SlotIsReleasedWhenBuilderIsDestroyed)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    {
+        CANFrameBuilder first(bus, 0x20);
+        CANFrameBuilder second(bus, 0x21);
+        CANFrameBuilder third(bus, 0x22);  // 送信領域は2つなので確保できない
+        EXPECT_TRUE(first.ok());
+        EXPECT_TRUE(second.ok());
+        EXPECT_FALSE(third.ok());
+        EXPECT_FALSE(third.commit());
+    }
+    EXPECT_TRUE(driver.sent_frames.empty());
+
+    CANFrameBuilder tx(bus, 0x23);
+    EXPECT_TRUE(tx.ok());
+}
+
+TEST(FrameBuilderTest, ZeroFillsOnlyDlcPadding)
+{
+    MockFDDriver driver;
+    FDCANBus bus(driver);
+
+    {
+        FDCANFrameBuilder tx(bus, 0x30);
+        uint8_t* data = tx.claim(FDCANFrame::MAX_DLC);
+        ASSERT_NE(data, nullptr);
+        std::memset(data, 0xAA, FDCANFrame::MAX_DLC);
+        EXPECT_TRUE(tx.commit());
+    }
+
+    FDCANFrameBuilder tx(bus, 0x31);
+    uint8_t* data = tx.claim(10);
+    ASSERT_NE(data, nullptr);
+    std::memset(data, 0x11, 10);
+    EXPECT_TRUE(tx.commit());
+
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    const FDCANFrame& sent = driver.sent_frames[1];
+    EXPECT_EQ(sent.dlc, 12);  // DLC で表せる長さに切り上げる
+    EXPECT_EQ(sent.data[9], 0x11);
+    // 12byteとして送られる範囲だけを0で埋め、その先は書き換えない
+    EXPECT_EQ(sent.data[10], 0);
+    EXPECT_EQ(sent.data[11], 0);
+    EXPECT_EQ(sent.data[12], 0xAA);
+}
+
+TEST(FrameBuilderTest, QueuesWhenHardwareIsBusy)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    driver.accept_send = false;
+
+    CANFrameBuilder tx(bus, 0x40);
+    tx.write(uint8_t{7});
+    EXPECT_TRUE(tx.commit());
+    EXPECT_EQ(bus.tx_queue_stats().depth, 1);
+
+    driver.accept_send = true;
+    bus.flush();
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(driver.sent_frames[0].data[0], 7);
+}
+
+TEST(FrameBuilderTest, StaticBusSendsDirectly)
+{
+    MockDriver driver;
+    StaticCANBus<BuilderDevice> bus(driver);
+    BuilderDevice device(bus, 2);
+    bus.bind(device);
+
+    EXPECT_TRUE(device.send_target(0.5f));
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(driver.sent_frames[0].dlc, sizeof(float));
+}
+
+TEST(FrameBuilderTest, ConcurrentBusWritesIntoRingAndSkipsCancelled)
+{
+    MockDriver driver;
+    ConcurrentCANBus bus(driver);
+    {
+        CANFrameBuilder cancelled(bus, 0x50);
+        cancelled.write(uint8_t{1});
+    }
+    CANFrameBuilder tx(bus, 0x51);
+    tx.write(uint8_t{2});
+    EXPECT_TRUE(tx.commit());
+    EXPECT_TRUE(driver.sent_frames.empty());
+
+    bus.flush();
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(driver.sent_frames[0].id, 0x51);
+    EXPECT_EQ(driver.sent_frames[0].data[0], 2);
+}
+
+TEST(FrameBuilderTest, DeviceCountsBuilderSends)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    BuilderDevice device(bus, 3);
+
+    EXPECT_TRUE(device.send_target(1.0f));
+    EXPECT_FALSE(device.send_oversized());
+    EXPECT_EQ(device.stats().tx_frames, 1);
+    EXPECT_EQ(device.stats().tx_failures, 1);
+    DeviceStats from_isr;
+    ASSERT_TRUE(device.try_stats(from_isr));
+    EXPECT_EQ(from_isr.tx_frames, 1);
+    EXPECT_EQ(from_isr.tx_failures, 1);
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    EXPECT_EQ(
+        driver.sent_frames[0].id,
+        id::pack(id::DeviceType::MotorDriver, 3, id::MsgTypeMotorDriver::Target)
+    );
+}
+
+TEST(FrameBuilderTest, ESCHubClientBuildsAngularVelocities)
+{
+    MockFDDriver driver;
+    FDCANBus bus(driver);
+    devices::ESCHubClient client(bus, 1);
+
+    float velocities[4] = {1.0f, -2.0f, 3.5f, 0.25f};
+    EXPECT_TRUE(client.set_angular_velocities(velocities));
+
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    const FDCANFrame& sent = driver.sent_frames[0];
+    EXPECT_EQ(
+        sent.id, id::pack(id::DeviceType::ESCHub, 1, id::MsgTypeESCHub::AngularVelocities)
+    );
+    EXPECT_EQ(sent.dlc, sizeof(velocities));
+    float decoded[4] = {};
+    std::memcpy(decoded, sent.data.data(), sizeof(decoded));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_FLOAT_EQ(decoded[i], velocities[i]);
+    }
+}
+
+TEST(FrameBuilderTest, SendWorksWhileBuilderIsHeld)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    BuilderDevice device(bus, 4);
+
+    CANFrameBuilder held(bus, 0x70);
+    EXPECT_TRUE(held.ok());
+    EXPECT_TRUE(device.send_gain(9));  // send() は送信領域を使わない
+    EXPECT_TRUE(held.commit());
+
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    EXPECT_EQ(driver.sent_frames[0].data[0], 9);
+    EXPECT_EQ(driver.sent_frames[1].id, 0x70);
+}
+
+TEST(FrameBuilderTest, TapCanBuildDuringCommit)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    ReplyingTap tap(bus);
+    bus.add_tap(tap);
+
+    CANFrameBuilder tx(bus, 0x60);
+    EXPECT_TRUE(tx.commit());  // 送信前に領域を返却するため、タップがビルダーを使える
+
+    EXPECT_TRUE(tap.reply_sent);
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    EXPECT_EQ(driver.sent_frames[1].id, 0x61);
+}
@@ -0,0 +1,149 @@
+// GN10_CAN_ENABLE_TIMESTAMP を定義してビルドする (tests/CMakeLists.txt 参照)
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "gn10_can/core/bus_tap.hpp"
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_can/drivers/buffered_driver.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+class FrameTimestampTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fake_now_us = 5000;
+        bus.set_time_source(fake_time_source);
+    }
+
+    // サーバー側のバスから送信したフレームを、受信時刻を指定してクライアント側へ渡す
+    void deliver_server_frames(TimestampUs driver_timestamp_us)
+    {
+        for (CANFrame frame : server_driver.sent_frames) {
+            frame.set_timestamp(driver_timestamp_us);
+            driver.push_receive_frame(frame);
+        }
+        server_driver.sent_frames.clear();
+        bus.update();
+    }
+
+    MockDriver driver;
+    CANBus bus{driver};
+    devices::MotorDriverClient client{bus, 1};
+
+    MockDriver server_driver;
+    CANBus server_bus{server_driver};
+    devices::MotorDriverServer server{server_bus, 1};
+};
+
+/**
+ * @brief 通知された時刻を記録するタップ
+ *
+ */
+class TimeRecordingTap : public CANTap
+{
+public:
+    void on_frame(const CANFrame&, TapDirection direction, TimestampUs timestamp_us) override
+    {
+        if (direction == TapDirection::Rx) {
+            rx_times.push_back(timestamp_us);
+        } else {
+            tx_times.push_back(timestamp_us);
+        }
+    }
+
+    std::vector<TimestampUs> rx_times;
+    std::vector<TimestampUs> tx_times;
+};
+
+}  // namespace
+
+TEST_F(FrameTimestampTest, FrameCarriesTimestampField)
+{
+    static_assert(CANFrame::HAS_TIMESTAMP, "test must be built with GN10_CAN_ENABLE_TIMESTAMP");
+    CANFrame frame;
+    frame.set_timestamp(42);
+    EXPECT_EQ(frame.timestamp_us, 42);
+}
+
+TEST_F(FrameTimestampTest, DriverTimestampIsKept)
+{
+    server.send_feedback(1.5f, 0x01);
+    deliver_server_frames(4200);  // ドライバーが設定した受信時刻
+
+    devices::MotorFeedback feedback = client.feedback();
+    EXPECT_FLOAT_EQ(feedback.value, 1.5f);
+    EXPECT_EQ(feedback.received_at_us, 4200);
+}
+
+TEST_F(FrameTimestampTest, BusStampsFramesWithoutDriverTimestamp)
+{
+    server.send_hardware_status(2.0f, 40);
+    deliver_server_frames(0);  // ドライバーが受信時刻に未対応
+
+    devices::MotorHardwareStatus status = client.hardware_status();
+    EXPECT_FLOAT_EQ(status.load_current, 2.0f);
+    EXPECT_EQ(status.received_at_us, 5000);  // バスが読み込んだ時刻
+
+    // 値の古さ = 現在時刻 - 受信時刻
+    fake_now_us = 5800;
+    EXPECT_EQ(fake_now_us - client.hardware_status().received_at_us, 800);
+}
+
+TEST_F(FrameTimestampTest, TapSeesReceiveTimeInsteadOfDispatchTime)
+{
+    TimeRecordingTap tap;
+    ASSERT_TRUE(bus.add_tap(tap));
+
+    server.send_feedback(1.0f, 0);
+    deliver_server_frames(4200);  // 5000us に配送するが、受信したのは 4200us
+    ASSERT_EQ(tap.rx_times.size(), 1);
+    EXPECT_EQ(tap.rx_times[0], 4200);
+
+    // 受信時刻を持たない送信フレームはバスの時刻
+    client.set_target(1.0f);
+    ASSERT_EQ(tap.tx_times.size(), 1);
+    EXPECT_EQ(tap.tx_times[0], 5000);
+}
+
+TEST_F(FrameTimestampTest, BufferedDriverStampsFramesInInterrupt)
+{
+    MockDriver hardware;
+    drivers::BufferedCANDriver<8> buffered(hardware);
+    buffered.set_time_source(fake_time_source);
+    CANBus buffered_bus(buffered);
+    buffered_bus.set_time_source(fake_time_source);
+    devices::MotorDriverClient buffered_client(buffered_bus, 1);
+
+    server.send_feedback(2.0f, 0);
+    for (const CANFrame& frame : server_driver.sent_frames) {
+        hardware.push_receive_frame(frame);
+    }
+    fake_now_us = 6000;
+    EXPECT_EQ(buffered.on_rx_interrupt(), 1);  // 割り込みで受信した時刻
+
+    fake_now_us = 6900;  // メインループが遅れて読み出す
+    buffered_bus.update();
+    EXPECT_EQ(buffered_client.feedback().received_at_us, 6000);
+
+    // HAL のコールバックから積んだフレームも、積んだ時刻になる
+    fake_now_us = 7000;
+    EXPECT_TRUE(buffered.push_from_isr(server_driver.sent_frames[0]));
+    fake_now_us = 7500;
+    buffered_bus.update();
+    EXPECT_EQ(buffered_client.feedback().received_at_us, 7000);
+}
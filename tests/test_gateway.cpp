@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_fd_gateway.hpp"
+#include "gn10_can/core/fdcan_bus.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+class GatewayTest : public ::testing::Test
+{
+protected:
+    MockDriver can_driver;
+    MockFDDriver fd_driver;
+    CANBus can_bus{can_driver};
+    FDCANBus fd_bus{fd_driver};
+    CANFDGateway<> gateway{can_bus, fd_bus};
+};
+
+TEST_F(GatewayTest, ForwardsClassicFrameToFD)
+{
+    ASSERT_TRUE(gateway.add_route(id::DeviceType::ESCHub, 0, GatewayDirection::CANToFD));
+
+    CANFrame frame =
+        CANFrame::make(id::DeviceType::ESCHub, 0, id::MsgTypeESCHub::Gain, {1, 2, 3});
+    can_driver.push_receive_frame(frame);
+    can_bus.update();
+
+    ASSERT_EQ(fd_driver.sent_frames.size(), 1);
+    EXPECT_EQ(fd_driver.sent_frames[0].id, frame.id);
+    EXPECT_EQ(fd_driver.sent_frames[0].dlc, 3);
+    EXPECT_EQ(fd_driver.sent_frames[0].data[2], 3);
+    EXPECT_EQ(gateway.stats().forwarded_to_fd, 1);
+}
+
+TEST_F(GatewayTest, IgnoresUnroutedFramesAndWrongDirection)
+{
+    gateway.add_route(id::DeviceType::ESCHub, 0, GatewayDirection::CANToFD);
+
+    can_driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 0, id::MsgTypeMotorDriver::Target)
+    );
+    can_bus.update();
+    fd_driver.push_receive_frame(
+        FDCANFrame::make(id::DeviceType::ESCHub, 0, id::MsgTypeESCHub::AngularVelocitiesFeedbacks)
+    );
+    fd_bus.update();
+
+    EXPECT_TRUE(fd_driver.sent_frames.empty());
+    EXPECT_TRUE(can_driver.sent_frames.empty());
+}
+
+TEST_F(GatewayTest, BothDirectionsAndOversizedFDFrameIsDropped)
+{
+    gateway.add_route(id::DeviceType::MotorDriver, 2, GatewayDirection::Both);
+
+    FDCANFrame feedback =
+        FDCANFrame::make(id::DeviceType::MotorDriver, 2, id::MsgTypeMotorDriver::Feedback, {9});
+    fd_driver.push_receive_frame(feedback);
+
+    std::array<uint8_t, 12> long_payload{};
+    fd_driver.push_receive_frame(FDCANFrame::make(
+        id::DeviceType::MotorDriver,
+        2,
+        id::MsgTypeMotorDriver::HardwareStatus,
+        long_payload.data(),
+        long_payload.size()
+    ));
+    fd_bus.update();
+
+    ASSERT_EQ(can_driver.sent_frames.size(), 1);
+    EXPECT_EQ(can_driver.sent_frames[0].id, feedback.id);
+    EXPECT_EQ(can_driver.sent_frames[0].data[0], 9);
+    EXPECT_EQ(gateway.stats().forwarded_to_can, 1);
+    EXPECT_EQ(gateway.stats().dropped_frames, 1);
+
+    can_driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 2, id::MsgTypeMotorDriver::Target, {1})
+    );
+    can_bus.update();
+    EXPECT_EQ(fd_driver.sent_frames.size(), 1);
+}
+
+TEST_F(GatewayTest, RouteCapacity)
+{
+    CANFDGateway<2> small_gateway{can_bus, fd_bus};
+    EXPECT_TRUE(small_gateway.add_route(id::DeviceType::ESCHub, 0, GatewayDirection::Both));
+    EXPECT_TRUE(small_gateway.add_route(id::DeviceType::ESCHub, 1, GatewayDirection::CANToFD));
+    EXPECT_FALSE(small_gateway.add_route(id::DeviceType::ESCHub, 2, GatewayDirection::Both));
+    EXPECT_TRUE(small_gateway.add_route(id::DeviceType::ESCHub, 3, GatewayDirection::FDToCAN));
+}
+
+TEST(GatewayPackingTest, AppendAndUnpackRoundTrip)
+{
+    FDCANFrame packed;
+    std::array<CANFrame, 8> frames{};
+    std::size_t appended = 0;
+    for (uint8_t i = 0; i < 8; ++i) {
+        frames[i] = CANFrame::make(
+            id::DeviceType::MotorDriver, i, id::MsgTypeMotorDriver::Target, {i, i, i, i, i, i, i, i}
+        );
+        if (packing::append(packed, frames[i])) {
+            appended++;
+        }
+    }
+    // 1 + 5 * (3 + 8) = 56 byte まで入り、6個目は入らない
+    EXPECT_EQ(appended, 5);
+    EXPECT_EQ(packed.dlc, 56);
+
+    std::array<CANFrame, 8> unpacked{};
+    ASSERT_EQ(packing::unpack(packed, unpacked.data(), unpacked.size()), 5);
+    for (std::size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(unpacked[i], frames[i]);
+    }
+
+    CANFrame extended;
+    extended.is_extended = true;
+    EXPECT_FALSE(packing::append(packed, extended));
+}
+
+TEST_F(GatewayTest, PacksFramesTowardFDUntilFlush)
+{
+    gateway.add_route(id::DeviceType::MotorDriver, 0, GatewayDirection::CANToFD);
+    gateway.add_route(id::DeviceType::MotorDriver, 1, GatewayDirection::CANToFD);
+    ASSERT_TRUE(gateway.enable_packing(
+        id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init
+    ));
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        can_driver.push_receive_frame(CANFrame::make(
+            id::DeviceType::MotorDriver, i % 2, id::MsgTypeMotorDriver::Target, {i, 0, 0, 0}
+        ));
+    }
+    can_bus.update();
+    EXPECT_TRUE(fd_driver.sent_frames.empty());
+
+    EXPECT_TRUE(gateway.flush());
+    ASSERT_EQ(fd_driver.sent_frames.size(), 1);
+    EXPECT_EQ(
+        fd_driver.sent_frames[0].id,
+        id::pack(id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init)
+    );
+    EXPECT_EQ(fd_driver.sent_frames[0].data[0], 4);
+    EXPECT_FALSE(gateway.flush());
+
+    GatewayStats stats = gateway.stats();
+    EXPECT_EQ(stats.forwarded_to_fd, 4);
+    EXPECT_EQ(stats.packed_frames, 1);
+
+    // 同じIDで届いたパック済みフレームは展開してCAN側へ中継する
+    fd_driver.push_receive_frame(fd_driver.sent_frames[0]);
+    fd_bus.update();
+    ASSERT_EQ(can_driver.sent_frames.size(), 4);
+    EXPECT_EQ(can_driver.sent_frames[3].data[0], 3);
+}
+
+TEST_F(GatewayTest, SendsPackedFrameOnUpdate)
+{
+    gateway.add_route(id::DeviceType::MotorDriver, 0, GatewayDirection::CANToFD);
+    ASSERT_TRUE(gateway.enable_packing(
+        id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init
+    ));
+
+    gateway.update();  // パック途中のフレームがなければ何も送らない
+    EXPECT_TRUE(fd_driver.sent_frames.empty());
+
+    can_driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 0, id::MsgTypeMotorDriver::Target, {1})
+    );
+    can_bus.update();
+    EXPECT_TRUE(fd_driver.sent_frames.empty());
+
+    // 受信した周期の update() で送信される
+    gateway.update();
+    ASSERT_EQ(fd_driver.sent_frames.size(), 1);
+    EXPECT_EQ(fd_driver.sent_frames[0].data[0], 1);
+    EXPECT_EQ(gateway.stats().forwarded_to_fd, 1);
+}
+
+TEST_F(GatewayTest, SendsPackedFrameAsSoonAsItIsFull)
+{
+    for (uint8_t dev_id = 0; dev_id < 6; ++dev_id) {
+        gateway.add_route(id::DeviceType::MotorDriver, dev_id, GatewayDirection::CANToFD);
+    }
+    ASSERT_TRUE(gateway.enable_packing(
+        id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init
+    ));
+
+    // 1 + 5 * (3 + 8) = 56 byte、6個目の 3 + 3 byte で 62 byte になり次のフレームは入らない
+    for (uint8_t i = 0; i < 5; ++i) {
+        can_driver.push_receive_frame(CANFrame::make(
+            id::DeviceType::MotorDriver, i, id::MsgTypeMotorDriver::Target, {i, i, i, i, i, i, i, i}
+        ));
+    }
+    can_driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 5, id::MsgTypeMotorDriver::Target, {5, 5, 5})
+    );
+    can_bus.update();
+
+    ASSERT_EQ(fd_driver.sent_frames.size(), 1);
+    EXPECT_EQ(fd_driver.sent_frames[0].data[0], 6);
+    EXPECT_FALSE(gateway.flush());
+}
+
+TEST_F(GatewayTest, CountsIgnoredFramesOnPackedId)
+{
+    ASSERT_TRUE(gateway.enable_packing(
+        id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Init
+    ));
+
+    fd_driver.push_receive_frame(FDCANFrame::make(
+        id::DeviceType::CommunicationModule, 15, id::MsgTypeCommunicationModule::Heartbeat, {1}
+    ));
+    fd_bus.update();
+
+    EXPECT_TRUE(can_driver.sent_frames.empty());
+    EXPECT_EQ(gateway.stats().ignored_frames, 1);
+    EXPECT_EQ(gateway.stats().dropped_frames, 0);
+}
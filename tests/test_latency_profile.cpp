@@ -0,0 +1,139 @@
+// GN10_CAN_ENABLE_LATENCY_PROFILE を定義してビルドする (tests/CMakeLists.txt 参照)
+#include <gtest/gtest.h>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/utils/latency_histogram.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+uint32_t fake_cycles = 0;
+
+uint32_t fake_cycle_counter()
+{
+    return fake_cycles;
+}
+
+// 受信処理に指定したサイクル数がかかったことにするデバイス
+class SlowDevice : public CANDevice
+{
+public:
+    SlowDevice(ICANBus& bus, id::DeviceType type, uint32_t cost)
+        : CANDevice(bus, type, 0), cost_(cost)
+    {
+    }
+
+    void on_receive(const CANFrame&) override
+    {
+        fake_cycles += cost_;
+    }
+
+private:
+    uint32_t cost_;
+};
+
+class LatencyProfileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fake_cycles = 1000;
+        bus.set_cycle_counter(fake_cycle_counter);
+    }
+
+    void push_frame(const CANDevice& device)
+    {
+        CANFrame frame;
+        frame.id = device.get_routing_id() << id::BIT_WIDTH_COMMAND;
+        driver.push_receive_frame(frame);
+    }
+
+    MockDriver driver;
+    CANBus bus{driver};
+};
+
+}  // namespace
+
+TEST(LatencyHistogramTest, BucketsArePowersOfTwo)
+{
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(0), 0);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(1), 1);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(2), 2);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(3), 2);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(1024), 11);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_of(UINT32_MAX), 32);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_upper_bound(11), 2047);
+    EXPECT_EQ(utils::LatencyHistogram::bucket_upper_bound(32), UINT32_MAX);
+}
+
+TEST(LatencyHistogramTest, PercentilesReportBucketUpperBound)
+{
+    utils::LatencyHistogram histogram;
+    EXPECT_EQ(histogram.percentile(99), 0);
+
+    for (int i = 0; i < 99; ++i) {
+        histogram.record(100);  // 区間 [64, 128)
+    }
+    histogram.record(5000);  // 区間 [4096, 8192)
+
+    EXPECT_EQ(histogram.count(), 100);
+    EXPECT_EQ(histogram.max(), 5000);
+    EXPECT_EQ(histogram.bucket(7), 99);
+    EXPECT_EQ(histogram.percentile(50), 127);
+    EXPECT_EQ(histogram.percentile(99), 127);
+    EXPECT_EQ(histogram.percentile(100), 5000);  // 区間の上限ではなく最大値で打ち切る
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0);
+    EXPECT_EQ(histogram.max(), 0);
+}
+
+TEST_F(LatencyProfileTest, RecordsHandlerTimePerDeviceType)
+{
+    SlowDevice motor(bus, id::DeviceType::MotorDriver, 300);
+    SlowDevice servo(bus, id::DeviceType::ServoMotor, 20);
+
+    push_frame(motor);
+    push_frame(servo);
+    push_frame(servo);
+    bus.update();
+
+    const LatencyProfile& profile = bus.latency_profile();
+    EXPECT_EQ(profile.handler(id::DeviceType::MotorDriver).count(), 1);
+    EXPECT_EQ(profile.handler(id::DeviceType::MotorDriver).max(), 300);
+    EXPECT_EQ(profile.handler(id::DeviceType::ServoMotor).count(), 2);
+    EXPECT_EQ(profile.handler(id::DeviceType::ServoMotor).max(), 20);
+    EXPECT_EQ(profile.handler(id::DeviceType::SolenoidDriver).count(), 0);
+
+    // update() 全体は受信処理の合計を含む
+    EXPECT_EQ(profile.update().count(), 1);
+    EXPECT_EQ(profile.update().max(), 340);
+}
+
+TEST_F(LatencyProfileTest, RecordsSendTime)
+{
+    CANFrame frame;
+    frame.id = 0x123;
+    EXPECT_TRUE(bus.send_frame(frame));
+    EXPECT_TRUE(bus.send_frame(frame));
+
+    EXPECT_EQ(bus.latency_profile().send().count(), 2);
+    EXPECT_EQ(bus.latency_profile().send().max(), 0);  // 偽のカウンタは送信中に進まない
+
+    bus.reset_latency_profile();
+    EXPECT_EQ(bus.latency_profile().send().count(), 0);
+}
+
+TEST_F(LatencyProfileTest, NothingIsRecordedWithoutCycleCounter)
+{
+    bus.set_cycle_counter(nullptr);
+    SlowDevice motor(bus, id::DeviceType::MotorDriver, 300);
+    push_frame(motor);
+    bus.update();
+
+    EXPECT_EQ(bus.latency_profile().update().count(), 0);
+    EXPECT_EQ(bus.latency_profile().handler(id::DeviceType::MotorDriver).count(), 0);
+}
@@ -131,3 +131,35 @@ TEST_F(MotorDriverTest, HardwareStatus)
     EXPECT_FLOAT_EQ(client.load_current(), current);
     EXPECT_EQ(client.temperature(), temp);
 }
+
+TEST_F(MotorDriverTest, IgnoresCommandsWithoutHandler)
+{
+    // Target はクライアントのテーブルに無いので、同じバスのクライアントの値は変わらない
+    client.set_target(0.5f);
+    ProcessBus();
+
+    EXPECT_FLOAT_EQ(client.feedback_value(), 0.0f);
+    EXPECT_FLOAT_EQ(client.load_current(), 0.0f);
+
+    float target;
+    EXPECT_TRUE(server.get_new_target(target));
+    EXPECT_FLOAT_EQ(target, 0.5f);
+}
+
+TEST_F(MotorDriverTest, StatsCountSendsAndParseFailures)
+{
+    client.set_target(0.5f);
+    EXPECT_EQ(client.stats().tx_frames, 1);
+
+    // データ長が足りないフィードバック
+    CANFrame short_feedback =
+        CANFrame::make(id::DeviceType::MotorDriver, dev_id, id::MsgTypeMotorDriver::Feedback, {1});
+    driver.push_receive_frame(short_feedback);
+    bus.update();
+
+    DeviceStats stats = client.stats();
+    EXPECT_EQ(stats.rx_frames, 1);
+    EXPECT_EQ(stats.parse_failures, 1);
+    EXPECT_EQ(bus.stats().parse_failures, 1);
+    EXPECT_EQ(server.stats().parse_failures, 0);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/can_device.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_can/devices/servo_motor_server.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+using namespace gn10_can::devices;
+
+namespace {
+
+class RecordingDevice : public CANDevice
+{
+public:
+    RecordingDevice(ICANBus& bus, uint8_t id) : CANDevice(bus, id::DeviceType::MotorDriver, id) {}
+
+    void on_receive(const CANFrame& frame) override
+    {
+        received_frames.push_back(frame);
+    }
+
+    std::vector<CANFrame> received_frames;
+};
+
+}  // namespace
+
+TEST(StaticBusTest, DispatchesToBoundDevices)
+{
+    MockDriver driver;
+    StaticCANBus<MotorDriverServer, ServoMotorServer, RecordingDevice> bus(driver);
+    MotorDriverServer motor(bus, 1);
+    ServoMotorServer servo(bus, 2);
+    RecordingDevice sniffer(bus, 1);  // motor と同じルーティングID
+    bus.bind(motor, servo, sniffer);
+
+    MockDriver client_driver;
+    CANBus client_bus(client_driver);
+    MotorDriverClient client(client_bus, 1);
+    client.set_target(0.25f);
+    client.set_target(0.5f);
+
+    for (const CANFrame& frame : client_driver.sent_frames) {
+        driver.push_receive_frame(frame);
+    }
+    driver.push_receive_frame(CANFrame::make(
+        id::DeviceType::ServoMotor, 2, id::MsgTypeServoMotor::AngleRad, {0, 0, 128, 63}
+    ));
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 3, id::MsgTypeMotorDriver::Target)
+    );
+    bus.update();
+
+    float target = 0.0f;
+    EXPECT_TRUE(motor.get_new_target(target));
+    EXPECT_FLOAT_EQ(target, 0.5f);
+    EXPECT_EQ(sniffer.received_frames.size(), 2);
+
+    float angle = 0.0f;
+    EXPECT_TRUE(servo.get_new_angle_rad(angle));
+    EXPECT_FLOAT_EQ(angle, 1.0f);
+}
+
+TEST(StaticBusTest, DestroyedDeviceIsNotDispatched)
+{
+    MockDriver driver;
+    StaticCANBus<RecordingDevice, RecordingDevice> bus(driver);
+    RecordingDevice first(bus, 1);
+    {
+        RecordingDevice second(bus, 1);
+        bus.bind(first, second);
+    }
+
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Target)
+    );
+    bus.update();
+    EXPECT_EQ(first.received_frames.size(), 1);
+}
+
+TEST(StaticBusTest, SendAndAcceptanceFilters)
+{
+    MockDriver driver;
+    StaticCANBus<MotorDriverServer, ServoMotorServer> bus(driver);
+    MotorDriverServer motor(bus, 1);
+    ServoMotorServer servo(bus, 2);
+    bus.bind(motor, servo);
+
+    EXPECT_TRUE(motor.send_feedback(1.0f, 0));
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+    driver.accept_send = false;
+    EXPECT_FALSE(motor.send_feedback(1.0f, 0));  // 送信キューは持たない
+
+    EXPECT_FALSE(bus.apply_acceptance_filters());
+    driver.max_filters = 14;
+    ASSERT_TRUE(bus.apply_acceptance_filters());
+    EXPECT_EQ(driver.acceptance_filters.size(), 2);
+}
+
+TEST(StaticBusTest, CountsDeviceRxStats)
+{
+    MockDriver driver;
+    StaticCANBus<MotorDriverServer, RecordingDevice> bus(driver);
+    MotorDriverServer motor(bus, 1);
+    RecordingDevice sniffer(bus, 2);
+    bus.bind(motor, sniffer);
+
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 1, id::MsgTypeMotorDriver::Target, {0, 0, 0, 0})
+    );
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 2, id::MsgTypeMotorDriver::Target)
+    );
+    driver.push_receive_frame(
+        CANFrame::make(id::DeviceType::MotorDriver, 2, id::MsgTypeMotorDriver::Gain)
+    );
+    bus.update();
+
+    // コマンドテーブルを持つデバイスもテーブルを持たないデバイスも、受信が統計に反映される
+    EXPECT_EQ(motor.stats().rx_frames, 1);
+    EXPECT_EQ(sniffer.stats().rx_frames, 2);
+    EXPECT_EQ(sniffer.received_frames.size(), 2);
+    float target = 1.0f;
+    EXPECT_TRUE(motor.get_new_target(target));
+    EXPECT_FLOAT_EQ(target, 0.0f);
+}
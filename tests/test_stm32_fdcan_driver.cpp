@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include "driver_stm32_fdcan.hpp"
+#include "hal_stub.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+class STM32FDCANDriverTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        hal_stub::reset();
+    }
+
+    FDCAN_HandleTypeDef handle_{};
+    drivers::DriverSTM32FDCAN driver_{&handle_};
+};
+
+}  // namespace
+
+TEST_F(STM32FDCANDriverTest, SendsFdFrameWithDlcCodeAndBrs)
+{
+    FDCANFrame frame;
+    frame.id              = 0x123;
+    frame.bit_rate_switch = true;
+    std::array<uint8_t, 20> bytes{};
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<uint8_t>(i + 1);
+    }
+    frame.set_data(bytes.data(), bytes.size());
+
+    ASSERT_TRUE(driver_.send(frame));
+    const FDCAN_TxHeaderTypeDef& header = hal_stub::fdcan_state().last_tx_header;
+    EXPECT_EQ(header.Identifier, 0x123u);
+    EXPECT_EQ(header.IdType, FDCAN_STANDARD_ID);
+    EXPECT_EQ(header.DataLength, FDCAN_DLC_BYTES_20);
+    EXPECT_EQ(header.FDFormat, FDCAN_FD_CAN);
+    EXPECT_EQ(header.BitRateSwitch, FDCAN_BRS_ON);
+    EXPECT_EQ(hal_stub::fdcan_state().last_tx_data[19], 20);
+}
+
+TEST_F(STM32FDCANDriverTest, SendsUnencodableLengthAsNextDlc)
+{
+    FDCANFrame frame;
+    frame.id  = 0x10;
+    frame.dlc = 33;  // set_data() を通さずに設定された長さも切り上げる
+
+    ASSERT_TRUE(driver_.send(frame));
+    EXPECT_EQ(hal_stub::fdcan_state().last_tx_header.DataLength, FDCAN_DLC_BYTES_48);
+}
+
+TEST_F(STM32FDCANDriverTest, SendsClassicFrameWithoutBrs)
+{
+    FDCANFrame frame;
+    frame.id              = 0x1ABCDE;
+    frame.is_extended     = true;
+    frame.is_fd           = false;
+    frame.bit_rate_switch = true;  // クラシックCANでは無視する
+    frame.set_data(std::array<uint8_t, 8>{}.data(), 8);
+
+    ASSERT_TRUE(driver_.send(frame));
+    const FDCAN_TxHeaderTypeDef& header = hal_stub::fdcan_state().last_tx_header;
+    EXPECT_EQ(header.IdType, FDCAN_EXTENDED_ID);
+    EXPECT_EQ(header.DataLength, FDCAN_DLC_BYTES_8);
+    EXPECT_EQ(header.FDFormat, FDCAN_CLASSIC_CAN);
+    EXPECT_EQ(header.BitRateSwitch, FDCAN_BRS_OFF);
+}
+
+TEST_F(STM32FDCANDriverTest, ClassicFlagIsIgnoredForLongFrames)
+{
+    FDCANFrame frame;
+    frame.is_fd = false;
+    frame.set_data(std::array<uint8_t, 16>{}.data(), 16);
+
+    ASSERT_TRUE(driver_.send(frame));
+    EXPECT_EQ(hal_stub::fdcan_state().last_tx_header.FDFormat, FDCAN_FD_CAN);
+}
+
+TEST_F(STM32FDCANDriverTest, ReceivesFullFdPayload)
+{
+    hal_stub::RxMessage message;
+    message.header.Identifier    = 0x321;
+    message.header.IdType        = FDCAN_STANDARD_ID;
+    message.header.DataLength    = FDCAN_DLC_BYTES_64;
+    message.header.FDFormat      = FDCAN_FD_CAN;
+    message.header.BitRateSwitch = FDCAN_BRS_ON;
+    message.data.fill(0x5A);
+    message.data[63] = 0xA5;
+    hal_stub::fdcan_state().rx_fifo.push_back(message);
+
+    FDCANFrame frame;
+    ASSERT_TRUE(driver_.receive(frame));
+    EXPECT_EQ(frame.id, 0x321u);
+    EXPECT_EQ(frame.dlc, 64);
+    EXPECT_TRUE(frame.is_fd);
+    EXPECT_TRUE(frame.bit_rate_switch);
+    EXPECT_EQ(frame.data[8], 0x5A);
+    EXPECT_EQ(frame.data[63], 0xA5);
+
+    EXPECT_FALSE(driver_.receive(frame));
+}
+
+TEST_F(STM32FDCANDriverTest, ReceivesClassicFrame)
+{
+    hal_stub::RxMessage message;
+    message.header.Identifier    = 0x55;
+    message.header.IdType        = FDCAN_STANDARD_ID;
+    message.header.DataLength    = FDCAN_DLC_BYTES_3;
+    message.header.FDFormat      = FDCAN_CLASSIC_CAN;
+    message.header.BitRateSwitch = FDCAN_BRS_OFF;
+    message.data[2]              = 0x77;
+    hal_stub::fdcan_state().rx_fifo.push_back(message);
+
+    FDCANFrame frame;
+    ASSERT_TRUE(driver_.receive(frame));
+    EXPECT_EQ(frame.dlc, 3);
+    EXPECT_EQ(frame.data[2], 0x77);
+    EXPECT_FALSE(frame.is_fd);
+    EXPECT_FALSE(frame.bit_rate_switch);
+}
+
+TEST_F(STM32FDCANDriverTest, RejectsEmptyAcceptanceFilterList)
+{
+    handle_.Init.StdFiltersNbr = 4;
+    const AcceptanceFilter filters[1] = {{0x100, 0x7F0}};
+
+    // 0個では全フレームを破棄する設定になるため受け付けない
+    EXPECT_FALSE(driver_.set_acceptance_filters(filters, 0));
+    EXPECT_TRUE(driver_.set_acceptance_filters(filters, 1));
+    EXPECT_FALSE(driver_.set_acceptance_filters(filters, 5));
+}
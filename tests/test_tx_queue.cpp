@@ -0,0 +1,313 @@
+#include <gtest/gtest.h>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/core/tx_queue.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/utils/can_converter.hpp"
+#include "mock_driver.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+TimestampUs fake_now_us = 0;
+
+TimestampUs fake_time_source()
+{
+    return fake_now_us;
+}
+
+CANFrame make_frame(uint32_t id, bool is_extended = false)
+{
+    CANFrame frame;
+    frame.id          = id;
+    frame.is_extended = is_extended;
+    return frame;
+}
+
+}  // namespace
+
+TEST(TxQueueTest, PopsInArbitrationOrder)
+{
+    detail::TxQueue<CANFrame, 8> queue;
+    queue.push(make_frame(0x300), 0);
+    queue.push(make_frame(0x100), 0);
+    queue.push(make_frame(0x200), 0);
+    queue.push(make_frame(0x100 << 18, true), 0);  // ベースIDが同じ拡張IDは標準IDに負ける
+
+    ASSERT_EQ(queue.size(), 4);
+    EXPECT_EQ(queue.top().frame.id, 0x100);
+    EXPECT_FALSE(queue.top().frame.is_extended);
+    queue.pop(0);
+    EXPECT_TRUE(queue.top().frame.is_extended);
+    queue.pop(0);
+    EXPECT_EQ(queue.top().frame.id, 0x200);
+    queue.pop(0);
+    EXPECT_EQ(queue.top().frame.id, 0x300);
+    queue.pop(0);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TxQueueTest, SameIdKeepsFifoOrder)
+{
+    detail::TxQueue<CANFrame, 4> queue;
+    for (uint8_t i = 0; i < 4; ++i) {
+        CANFrame frame = make_frame(0x123);
+        frame.data[0]  = i;
+        frame.dlc      = 1;
+        queue.push(frame, 0);
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(queue.top().frame.data[0], i);
+        queue.pop(0);
+    }
+}
+
+TEST(TxQueueTest, FullQueueEvictsLowestPriority)
+{
+    detail::TxQueue<CANFrame, 2> queue;
+    EXPECT_TRUE(queue.push(make_frame(0x200), 0, TxMode::Coalesce));
+    EXPECT_TRUE(queue.push(make_frame(0x300), 0, TxMode::Coalesce));
+
+    EXPECT_FALSE(queue.push(make_frame(0x400), 0));  // 最も低い優先度なので破棄
+    EXPECT_TRUE(queue.push(make_frame(0x100), 0));   // 0x300 を追い出す
+
+    TxQueueStats stats = queue.stats();
+    EXPECT_EQ(stats.dropped_frames, 2);
+    EXPECT_EQ(stats.queued_frames, 3);
+    EXPECT_EQ(stats.depth, 2);
+    EXPECT_EQ(stats.max_depth, 2);
+
+    EXPECT_EQ(queue.top().frame.id, 0x100);
+    queue.pop(0);
+    EXPECT_EQ(queue.top().frame.id, 0x200);
+}
+
+TEST(TxQueueTest, FullQueueNeverEvictsDeliverFrames)
+{
+    detail::TxQueue<CANFrame, 2> queue;
+    EXPECT_TRUE(queue.push(make_frame(0x200), 0));
+    EXPECT_TRUE(queue.push(make_frame(0x300), 0, TxMode::Coalesce));
+
+    // 0x300 (Coalesce) は追い出せるが、残る 0x200 (Deliver) は追い出さない
+    EXPECT_TRUE(queue.push(make_frame(0x100), 0));
+    EXPECT_FALSE(queue.push(make_frame(0x050), 0, TxMode::Coalesce));
+
+    ASSERT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.top().frame.id, 0x100);
+    queue.pop(0);
+    EXPECT_EQ(queue.top().frame.id, 0x200);
+}
+
+TEST(TxQueueTest, FramesAreContiguousInArbitrationOrder)
+{
+    detail::TxQueue<CANFrame, 4> queue;
+    queue.push(make_frame(0x300), 0);
+    queue.push(make_frame(0x100), 0);
+    queue.push(make_frame(0x200), 0);
+
+    const CANFrame* frames = queue.frames();
+    EXPECT_EQ(frames[0].id, 0x100);
+    EXPECT_EQ(frames[1].id, 0x200);
+    EXPECT_EQ(frames[2].id, 0x300);
+
+    queue.pop(0, 2);
+    ASSERT_EQ(queue.size(), 1);
+    EXPECT_EQ(queue.frames()[0].id, 0x300);
+}
+
+TEST(TxQueueBusTest, QueuesWhenHardwareIsFullAndFlushesByPriority)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    fake_now_us = 1000;
+    bus.set_time_source(fake_time_source);
+
+    EXPECT_TRUE(bus.send_frame(make_frame(0x010)));
+    ASSERT_EQ(driver.sent_frames.size(), 1);
+
+    driver.accept_send = false;
+    EXPECT_TRUE(bus.send_frame(make_frame(0x300)));
+    EXPECT_TRUE(bus.send_frame(make_frame(0x100)));
+    EXPECT_TRUE(bus.send_frame(make_frame(0x200)));
+    EXPECT_EQ(bus.tx_queue_stats().depth, 3);
+
+    fake_now_us        = 1250;
+    driver.accept_send = true;
+    EXPECT_EQ(bus.flush(), 3);
+
+    ASSERT_EQ(driver.sent_frames.size(), 4);
+    EXPECT_EQ(driver.sent_frames[1].id, 0x100);
+    EXPECT_EQ(driver.sent_frames[2].id, 0x200);
+    EXPECT_EQ(driver.sent_frames[3].id, 0x300);
+
+    TxQueueStats stats = bus.tx_queue_stats();
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.max_depth, 3);
+    EXPECT_EQ(stats.max_wait_us, 250);
+    EXPECT_EQ(stats.total_wait_us, 750);
+}
+
+TEST(TxQueueBusTest, NewFrameWaitsBehindQueuedFrames)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+
+    driver.accept_send = false;
+    bus.send_frame(make_frame(0x100));
+
+    // ハードウェアが空いても、先に積まれたフレームを追い越さない
+    driver.accept_send = true;
+    bus.send_frame(make_frame(0x200));
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    EXPECT_EQ(driver.sent_frames[0].id, 0x100);
+    EXPECT_EQ(driver.sent_frames[1].id, 0x200);
+}
+
+TEST(TxQueueBusTest, UpdateFlushesQueue)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+
+    driver.accept_send = false;
+    bus.send_frame(make_frame(0x100));
+    EXPECT_TRUE(driver.sent_frames.empty());
+
+    driver.accept_send = true;
+    bus.update();
+    EXPECT_EQ(driver.sent_frames.size(), 1);
+}
+
+TEST(TxQueueBusTest, FlushHandsQueuedFramesToSendBatch)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+
+    driver.accept_send = false;
+    bus.send_frame(make_frame(0x300));
+    bus.send_frame(make_frame(0x100));
+    bus.send_frame(make_frame(0x200));
+
+    // 送信FIFOの空きが2つなら、優先度の高い2つだけ送られ、残りはキューに残る
+    driver.accept_send      = true;
+    driver.batch_limit      = 2;
+    driver.send_batch_calls = 0;
+    EXPECT_EQ(bus.flush(), 2);
+    EXPECT_EQ(driver.send_batch_calls, 1);
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    EXPECT_EQ(driver.sent_frames[0].id, 0x100);
+    EXPECT_EQ(driver.sent_frames[1].id, 0x200);
+    EXPECT_EQ(bus.tx_queue_stats().depth, 1);
+
+    EXPECT_EQ(bus.flush(), 1);
+    EXPECT_EQ(driver.send_batch_calls, 2);
+    ASSERT_EQ(driver.sent_frames.size(), 3);
+    EXPECT_EQ(driver.sent_frames[2].id, 0x300);
+}
+
+TEST(TxQueueBusTest, WithoutQueueSendFailureIsReported)
+{
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 16, 0> bus(driver);
+
+    driver.accept_send = false;
+    EXPECT_FALSE(bus.send_frame(make_frame(0x100)));
+    EXPECT_EQ(bus.flush(), 0);
+}
+
+TEST(TxQueueBusTest, DeviceSendReportsDrop)
+{
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 16, 1> bus(driver);
+    devices::MotorDriverClient client(bus, 0);
+
+    driver.accept_send = false;
+    EXPECT_TRUE(client.set_gain(devices::GainType::Kp, 1.0f));   // キューに積まれる
+    EXPECT_FALSE(client.set_gain(devices::GainType::Kp, 2.0f));  // 同じIDで後着なので破棄
+    EXPECT_EQ(bus.tx_queue_stats().dropped_frames, 1);
+}
+
+TEST(TxQueueCoalesceTest, SameIdOverwritesInPlace)
+{
+    detail::TxQueue<CANFrame, 4> queue;
+    CANFrame frame = make_frame(0x200);
+    frame.dlc      = 1;
+
+    frame.data[0] = 1;
+    queue.push(frame, 10, TxMode::Coalesce);
+    queue.push(make_frame(0x300), 20);
+    frame.data[0] = 2;
+    EXPECT_TRUE(queue.push(frame, 30, TxMode::Coalesce));
+
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.stats().coalesced_frames, 1);
+    EXPECT_EQ(queue.top().frame.data[0], 2);
+    EXPECT_EQ(queue.top().queued_us, 10);  // 待ち時間の起点は最初に積んだ時刻
+}
+
+TEST(TxQueueCoalesceTest, DeliverFramesAreNeverOverwritten)
+{
+    detail::TxQueue<CANFrame, 4> queue;
+    queue.push(make_frame(0x200), 0);
+    queue.push(make_frame(0x200), 0, TxMode::Coalesce);  // Deliver のフレームは上書きしない
+    queue.push(make_frame(0x200), 0);
+
+    EXPECT_EQ(queue.size(), 3);
+    EXPECT_EQ(queue.stats().coalesced_frames, 0);
+}
+
+TEST(TxQueueCoalesceTest, QueuedGainIsNotLostWhenFull)
+{
+    MockDriver driver;
+    BasicBus<CANFrame, drivers::ICANDriver, 16, 2> bus(driver);
+    devices::MotorDriverClient client(bus, 0);
+
+    driver.accept_send = false;
+    EXPECT_TRUE(client.set_gain(devices::GainType::Kp, 1.0f));
+    EXPECT_TRUE(client.set_gain(devices::GainType::Ki, 2.0f));
+    EXPECT_FALSE(client.set_target(3.0f));  // 送信済みとして受け付けたゲインは追い出さない
+
+    driver.accept_send = true;
+    bus.flush();
+    ASSERT_EQ(driver.sent_frames.size(), 2);
+    for (const CANFrame& sent : driver.sent_frames) {
+        EXPECT_TRUE(id::unpack(sent.id).is_command(id::MsgTypeMotorDriver::Gain));
+    }
+    EXPECT_EQ(bus.tx_queue_stats().dropped_frames, 1);
+}
+
+TEST(TxQueueCoalesceTest, DeviceTargetCoalescesAndInitIsDelivered)
+{
+    MockDriver driver;
+    CANBus bus(driver);
+    devices::MotorDriverClient client(bus, 0);
+
+    driver.accept_send = false;
+    EXPECT_TRUE(client.set_init(devices::MotorConfig{}));
+    EXPECT_TRUE(client.set_init(devices::MotorConfig{}));
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(client.set_target(static_cast<float>(i)));
+    }
+    EXPECT_EQ(bus.tx_queue_stats().depth, 3);
+    EXPECT_EQ(bus.tx_queue_stats().coalesced_frames, 4);
+
+    driver.accept_send = true;
+    bus.flush();
+    ASSERT_EQ(driver.sent_frames.size(), 3);
+
+    int init_count   = 0;
+    int target_count = 0;
+    float target     = 0.0f;
+    for (const CANFrame& sent : driver.sent_frames) {
+        id::IdFields fields = id::unpack(sent.id);
+        if (fields.is_command(id::MsgTypeMotorDriver::Init)) {
+            init_count++;
+        } else if (fields.is_command(id::MsgTypeMotorDriver::Target)) {
+            target_count++;
+            converter::unpack(sent.data, 0, target);
+        }
+    }
+    EXPECT_EQ(init_count, 2);
+    EXPECT_EQ(target_count, 1);
+    EXPECT_FLOAT_EQ(target, 4.0f);
+}
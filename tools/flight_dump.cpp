@@ -0,0 +1,153 @@
+/**
+ * @file flight_dump.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フライトレコーダーのダンプ (BasicFlightRecorder::dump()) を時系列で表示するツール
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026 Gento Aiba
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方: gn10_can_flight_dump <dump.bin>   (ファイル名に - を指定すると標準入力から読む)
+ * UART などで16進文字列として吸い出した場合は `xxd -r -p` でバイナリに戻してから渡します。
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "gn10_can/core/can_id.hpp"
+#include "gn10_can/core/flight_recorder.hpp"
+
+using namespace gn10_can;
+
+namespace {
+
+const char* device_type_name(id::DeviceType type)
+{
+    switch (type) {
+        case id::DeviceType::EmergencyStop:
+            return "EmergencyStop";
+        case id::DeviceType::MotorDriver:
+            return "MotorDriver";
+        case id::DeviceType::ServoMotor:
+            return "ServoMotor";
+        case id::DeviceType::SolenoidDriver:
+            return "SolenoidDriver";
+        case id::DeviceType::CommunicationModule:
+            return "CommunicationModule";
+        case id::DeviceType::SensorHub:
+            return "SensorHub";
+        case id::DeviceType::LED:
+            return "LED";
+        case id::DeviceType::ESCHub:
+            return "ESCHub";
+    }
+    return "Unknown";
+}
+
+bool read_file(const char* path, std::vector<uint8_t>& out)
+{
+    FILE* file = stdin;
+    if (std::strcmp(path, "-") != 0) {
+        file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            return false;
+        }
+    }
+    uint8_t chunk[4096];
+    std::size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        out.insert(out.end(), chunk, chunk + read);
+    }
+    if (file != stdin) {
+        std::fclose(file);
+    }
+    return true;
+}
+
+void print_entry(const FlightRecordEntry& entry, TimestampUs last_us)
+{
+    // 最後の記録（トリガー後の最終フレーム）を0とした相対時刻で表示する
+    int32_t relative_us   = static_cast<int32_t>(entry.timestamp_us - last_us);
+    const char* direction = "RX";
+    if (entry.direction == TapDirection::Tx) {
+        direction = "TX";
+    }
+    std::printf(
+        "%12.3f  %10u  %s  ",
+        static_cast<double>(relative_us) / 1000.0,
+        static_cast<unsigned>(entry.timestamp_us),
+        direction
+    );
+    if (entry.is_extended) {
+        std::printf("%08X  ", static_cast<unsigned>(entry.id));
+    } else {
+        std::printf("     %03X  ", static_cast<unsigned>(entry.id));
+    }
+    std::printf("[%2u]", static_cast<unsigned>(entry.length));
+    for (std::size_t i = 0; i < entry.length; ++i) {
+        std::printf(" %02X", entry.data[i]);
+    }
+    if (!entry.is_extended) {
+        id::IdFields fields = id::unpack(entry.id);
+        std::printf(
+            "  %s #%u cmd %u",
+            device_type_name(fields.type),
+            static_cast<unsigned>(fields.dev_id),
+            static_cast<unsigned>(fields.command)
+        );
+    }
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <dump.bin | ->\n", argv[0]);
+        return 2;
+    }
+    std::vector<uint8_t> dump;
+    if (!read_file(argv[1], dump)) {
+        std::fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    // 相対時刻の基準にする最後の記録の時刻を先に求める
+    FlightRecordReader scan(dump.data(), dump.size());
+    if (!scan.valid()) {
+        std::fprintf(stderr, "not a flight recorder dump\n");
+        return 1;
+    }
+    FlightRecordEntry entry;
+    TimestampUs last_us = 0;
+    while (scan.next(entry)) {
+        last_us = entry.timestamp_us;
+    }
+
+    FlightRecordReader reader(dump.data(), dump.size());
+    const char* bus = "CAN";
+    if (reader.is_fd()) {
+        bus = "CAN FD";
+    }
+    const char* state = "recording";
+    if (reader.frozen()) {
+        state = "frozen by trigger";
+    }
+    std::printf("# %u entries, %s, %s\n", static_cast<unsigned>(reader.entry_count()), bus, state);
+    std::printf("%12s  %10s  %s  %8s  %s\n", "rel[ms]", "time[us]", "  ", "id", "data");
+
+    std::size_t printed = 0;
+    while (reader.next(entry)) {
+        print_entry(entry, last_us);
+        printed++;
+    }
+    if (!reader.valid()) {
+        std::fprintf(stderr, "dump is truncated after %zu entries\n", printed);
+        return 1;
+    }
+    return 0;
+}